@@ -0,0 +1,73 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Sparsh Jain
+ *
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+#include "harness.hpp"
+
+// Replacement global allocation functions that count every allocation
+// The nothrow and sized variants of the standard library forward here.
+
+namespace
+{
+    std::atomic<std::uint64_t> g_allocations{0};
+    std::atomic<std::uint64_t> g_bytes{0};
+
+    void *allocate(std::size_t size)
+    {
+        g_allocations.fetch_add(1, std::memory_order_relaxed);
+        g_bytes.fetch_add(size, std::memory_order_relaxed);
+
+        if (void *p = std::malloc(size ? size : 1))
+            return p;
+        throw std::bad_alloc{};
+    }
+
+    void *allocateAligned(std::size_t size, std::align_val_t alignment)
+    {
+        g_allocations.fetch_add(1, std::memory_order_relaxed);
+        g_bytes.fetch_add(size, std::memory_order_relaxed);
+
+        // aligned_alloc wants a multiple of the alignment
+        const auto align = static_cast<std::size_t>(alignment);
+        const auto rounded = (std::max<std::size_t>(size, 1) + align - 1) / align * align;
+        if (void *p = std::aligned_alloc(align, rounded))
+            return p;
+        throw std::bad_alloc{};
+    }
+}
+
+namespace Bench
+{
+    std::uint64_t allocationCount()
+    {
+        return g_allocations.load(std::memory_order_relaxed);
+    }
+
+    std::uint64_t allocatedBytes()
+    {
+        return g_bytes.load(std::memory_order_relaxed);
+    }
+}
+
+void *operator new(std::size_t size) { return allocate(size); }
+void *operator new[](std::size_t size) { return allocate(size); }
+void *operator new(std::size_t size, std::align_val_t alignment) { return allocateAligned(size, alignment); }
+void *operator new[](std::size_t size, std::align_val_t alignment) { return allocateAligned(size, alignment); }
+
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete[](void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void *p, std::size_t) noexcept { std::free(p); }
+void operator delete(void *p, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void *p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void *p, std::size_t, std::align_val_t) noexcept { std::free(p); }
@@ -0,0 +1,152 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Sparsh Jain
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <cpp_eigen_opencv/shared/ndarray.hpp>
+#include <cpp_eigen_opencv/shared/geometry.hpp>
+
+#include "harness.hpp"
+
+namespace
+{
+    using namespace Bench;
+
+    void benchNDArray(Runner &runner)
+    {
+        // Tiny temporaries like the edge vectors of minAreaRectangle
+        runner.run("ndarray.small", "dense", 2, 2, []()
+                   {
+                       const auto p = NDArray<double, 1>({1.0, 2.0});
+                       doNotOptimize(p - NDArray<double, 1>({3.0, 5.0})); });
+
+        for (const size_type n : {size_type{1} << 10, size_type{1} << 16, size_type{1} << 20})
+        {
+            auto a = NDArray<double, 1>::Empty({n});
+            auto b = NDArray<double, 1>::Empty({n});
+            for (size_type i = 0; i < n; ++i)
+            {
+                a[i] = 1.0 + static_cast<double>(i % 97);
+                b[i] = 2.0 - static_cast<double>(i % 89);
+            }
+
+            runner.run("ndarray.add", "dense", n, n, [&]()
+                       { doNotOptimize(a + b); });
+            runner.run("ndarray.scale", "dense", n, n, [&]()
+                       { doNotOptimize(a * 2.0); });
+            runner.run("ndarray.dot", "dense", n, n, [&]()
+                       { doNotOptimize(ND::dot(a, b)); });
+            runner.run("ndarray.norm", "dense", n, n, [&]()
+                       { doNotOptimize(ND::norm(a)); });
+
+            // Gather in a random order, as after a sort by index
+            std::vector<size_type> shuffled(n);
+            std::iota(shuffled.begin(), shuffled.end(), size_type{0});
+            std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937(7));
+            runner.run("ndarray.take", "random", n, n, [&]()
+                       { doNotOptimize(ND::take(a, shuffled)); });
+
+            // Conversions around the float kernels, fused with a scale
+            const auto pixels = (a * 2.0).AsType<std::uint8_t>();
+            const auto normalized = pixels.AsType<float>(1.0 / 255.0, 0.0);
+            runner.run("ndarray.astype_u8_f32", "dense", n, n, [&]()
+                       { doNotOptimize(pixels.AsType<float>(1.0 / 255.0, 0.0)); });
+            runner.run("ndarray.astype_f32_u8", "dense", n, n, [&]()
+                       { doNotOptimize(normalized.AsType<std::uint8_t>(255.0, 0.0)); });
+
+            // Same sum through flat indexing and through Ravel
+            const auto side = static_cast<size_type>(std::sqrt(static_cast<double>(n)));
+            const auto matrix = NDArray<double, 2>(a.data(), {side, side});
+            runner.run("ndarray.flat_index", "dense", n, side * side, [&]()
+                       {
+                           double sum = 0.0;
+                           for (size_type i = 0; i < side * side; ++i)
+                               sum += matrix[i];
+                           doNotOptimize(sum); });
+            runner.run("ndarray.ravel_index", "dense", n, side * side, [&]()
+                       {
+                           double sum = 0.0;
+                           for (size_type i = 0; i < side; ++i)
+                           {
+                               for (size_type j = 0; j < side; ++j)
+                                   sum += matrix(i, j);
+                           }
+                           doNotOptimize(sum); });
+
+            // In-place writes through Ravel on a plain array, which have to
+            // stay free of per-element checks to vectorize
+            auto image = NDArray<float, 2>::Full({side, side}, 1.0f);
+            runner.run("ndarray.ravel_write", "dense", n, side * side, [&]()
+                       {
+                           for (size_type i = 0; i < side; ++i)
+                           {
+                               for (size_type j = 0; j < side; ++j)
+                                   image(i, j) = image(i, j) * 0.5f + 1.0f;
+                           }
+                           doNotOptimize(image); });
+
+            // Blocked copy of a transposed view against the plain loop
+            runner.run("ndarray.transpose", "dense", n, side * side, [&]()
+                       { doNotOptimize(matrix.Transpose().Copy()); });
+            runner.run("ndarray.transpose_naive", "dense", n, side * side, [&]()
+                       {
+                           auto out = NDArray<double, 2>::Empty({side, side});
+                           for (size_type i = 0; i < side; ++i)
+                           {
+                               for (size_type j = 0; j < side; ++j)
+                                   out(i, j) = matrix(j, i);
+                           }
+                           doNotOptimize(out); });
+        }
+    }
+
+    template <typename T>
+    void benchGeometryType(Runner &runner, const std::string &type, double factor)
+    {
+        for (const auto distribution : {Distribution::Uniform, Distribution::Circle, Distribution::Clustered})
+        {
+            const std::string name = distributionName(distribution);
+            for (const size_type n : {size_type{1} << 10, size_type{1} << 14, size_type{1} << 18})
+            {
+                const auto points = convertPoints<T>(makePoints(distribution, n), factor);
+
+                runner.run("argSortPoints." + type, name, n, n, [&]()
+                           { doNotOptimize(Geometry::argSortPoints(points)); });
+                runner.run("computeConvexHull." + type, name, n, n, [&]()
+                           { doNotOptimize(Geometry::computeConvexHull(points)); });
+
+                // The floating point rectangle is quadratic in the hull
+                // size, and every circle point is on the hull
+                if (distribution == Distribution::Circle && n > (size_type{1} << 12) && !Geometry::PixelIntegral<T>)
+                    continue;
+
+                runner.run("minAreaRectangle." + type, name, n, n, [&]()
+                           { doNotOptimize(Geometry::minAreaRectangle(points)); });
+            }
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    Bench::Options options;
+    if (!Bench::parseOptions(argc, argv, options))
+        return 1;
+
+    Bench::Runner runner(options);
+    benchNDArray(runner);
+    benchGeometryType<double>(runner, "f64", 1.0);
+    benchGeometryType<std::int16_t>(runner, "i16", 30000.0);
+
+    return runner.finish() ? 0 : 1;
+}
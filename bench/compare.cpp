@@ -0,0 +1,381 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Sparsh Jain
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <opencv2/opencv.hpp>
+#include <Eigen/Dense>
+
+#include <cpp_eigen_opencv/shared/ndarray.hpp>
+#include <cpp_eigen_opencv/shared/geometry.hpp>
+#include <cpp_eigen_opencv/shared/moments.hpp>
+#include <cpp_eigen_opencv/shared/distance_transform.hpp>
+
+#include "harness.hpp"
+
+// Runs NDArray and Geometry routines next to their Eigen and OpenCV
+// counterparts on the same inputs, checks that the results agree and
+// reports how long ours takes relative to theirs.
+
+namespace
+{
+    using namespace Bench;
+
+    struct Comparison
+    {
+        std::string name{};
+        double ratio{0.0}; // our time over theirs, below 1 is faster
+        bool matches{false};
+    };
+
+    class Comparer final
+    {
+    private:
+        Runner &m_runner;
+        std::vector<Comparison> m_comparisons{};
+
+    public:
+        explicit Comparer(Runner &runner)
+            : m_runner(runner)
+        {
+        }
+
+        // Times ours and theirs under their own names, then checks their
+        // results with check(ours(), theirs()) if both passed the filter
+        template <typename Ours, typename Theirs, typename Check>
+        void compare(
+            const std::string &benchmark,
+            const std::string &counterpart,
+            const std::string &distribution,
+            const size_type size,
+            const size_type elements,
+            Ours &&ours,
+            Theirs &&theirs,
+            Check &&check)
+        {
+            const auto before = m_runner.results().size();
+            m_runner.run(benchmark, distribution, size, elements, [&]()
+                         { doNotOptimize(ours()); });
+            m_runner.run(counterpart, distribution, size, elements, [&]()
+                         { doNotOptimize(theirs()); });
+
+            const auto &results = m_runner.results();
+            if (results.size() != before + 2)
+                return;
+
+            Comparison comparison{};
+            comparison.name = results[before].name + " vs " + counterpart;
+            comparison.ratio = results[before].nsPerIteration / results[before + 1].nsPerIteration;
+            comparison.matches = check(ours(), theirs());
+            if (!comparison.matches)
+                std::cerr << "MISMATCH " << comparison.name << std::endl;
+            m_comparisons.push_back(std::move(comparison));
+        }
+
+        // Prints the ratios and returns whether every result matched
+        bool summarize() const
+        {
+            std::cout << "\n"
+                      << std::left << std::setw(72) << "comparison" << std::right
+                      << std::setw(10) << "ratio" << "  result" << std::endl;
+
+            bool allMatch = true;
+            for (const auto &c : m_comparisons)
+            {
+                std::cout << std::left << std::setw(72) << c.name << std::right
+                          << std::fixed << std::setprecision(3) << std::setw(10) << c.ratio
+                          << std::defaultfloat << (c.matches ? "  ok" : "  MISMATCH") << std::endl;
+                allMatch = allMatch && c.matches;
+            }
+            return allMatch;
+        }
+    };
+
+    bool nearlyEqual(double a, double b, double tolerance)
+    {
+        return std::abs(a - b) <= tolerance * std::max({1.0, std::abs(a), std::abs(b)});
+    }
+
+    template <typename Points>
+    double shoelaceArea(const Points &x, const Points &y, size_type n)
+    {
+        double area = 0.0;
+        for (size_type i = 0; i < n; ++i)
+        {
+            const auto j = (i + 1) % n;
+            area += x[i] * y[j] - x[j] * y[i];
+        }
+        return 0.5 * std::abs(area);
+    }
+
+    template <typename T>
+    double hullArea(const NDArray<T, 2> &hull)
+    {
+        const auto n = hull.shape()[0];
+        std::vector<double> x(n), y(n);
+        for (size_type i = 0; i < n; ++i)
+        {
+            x[i] = static_cast<double>(hull(i, 0));
+            y[i] = static_cast<double>(hull(i, 1));
+        }
+        return shoelaceArea(x, y, n);
+    }
+
+    template <typename P>
+    double hullArea(const std::vector<P> &hull)
+    {
+        const auto n = hull.size();
+        std::vector<double> x(n), y(n);
+        for (size_type i = 0; i < n; ++i)
+        {
+            x[i] = static_cast<double>(hull[i].x);
+            y[i] = static_cast<double>(hull[i].y);
+        }
+        return shoelaceArea(x, y, n);
+    }
+
+    bool sameMoments(const Geometry::Moments &a, const cv::Moments &b, double tolerance)
+    {
+        return nearlyEqual(a.m00, b.m00, tolerance) && nearlyEqual(a.m10, b.m10, tolerance) &&
+               nearlyEqual(a.m01, b.m01, tolerance) && nearlyEqual(a.m20, b.m20, tolerance) &&
+               nearlyEqual(a.m11, b.m11, tolerance) && nearlyEqual(a.m02, b.m02, tolerance) &&
+               nearlyEqual(a.m30, b.m30, tolerance) && nearlyEqual(a.m21, b.m21, tolerance) &&
+               nearlyEqual(a.m12, b.m12, tolerance) && nearlyEqual(a.m03, b.m03, tolerance);
+    }
+
+    void compareEigen(Comparer &comparer)
+    {
+        for (const size_type n : {size_type{1} << 10, size_type{1} << 16, size_type{1} << 20})
+        {
+            auto a = NDArray<double, 1>::Empty({n});
+            auto b = NDArray<double, 1>::Empty({n});
+            for (size_type i = 0; i < n; ++i)
+            {
+                a[i] = 1.0 + static_cast<double>(i % 97);
+                b[i] = 2.0 - static_cast<double>(i % 89);
+            }
+
+            const auto size = static_cast<Eigen::Index>(n);
+            const Eigen::ArrayXd ea = Eigen::Map<const Eigen::ArrayXd>(a.data(), size);
+            const Eigen::ArrayXd eb = Eigen::Map<const Eigen::ArrayXd>(b.data(), size);
+            const Eigen::VectorXd va = ea.matrix();
+            const Eigen::VectorXd vb = eb.matrix();
+
+            const auto sameArray = [n](const NDArray<double, 1> &ours, const Eigen::ArrayXd &theirs)
+            {
+                for (size_type i = 0; i < n; ++i)
+                {
+                    if (ours[i] != theirs[static_cast<Eigen::Index>(i)])
+                        return false;
+                }
+                return true;
+            };
+            const auto sameScalar = [](double ours, double theirs)
+            { return nearlyEqual(ours, theirs, 1e-12); };
+
+            comparer.compare(
+                "ndarray.add", "eigen.add", "dense", n, n,
+                [&]()
+                { return a + b; },
+                [&]() -> Eigen::ArrayXd
+                { return ea + eb; },
+                sameArray);
+            comparer.compare(
+                "ndarray.scale", "eigen.scale", "dense", n, n,
+                [&]()
+                { return a * 2.0; },
+                [&]() -> Eigen::ArrayXd
+                { return ea * 2.0; },
+                sameArray);
+            comparer.compare(
+                "ndarray.dot", "eigen.dot", "dense", n, n,
+                [&]()
+                { return ND::dot(a, b); },
+                [&]()
+                { return va.dot(vb); },
+                sameScalar);
+            comparer.compare(
+                "ndarray.norm", "eigen.norm", "dense", n, n,
+                [&]()
+                { return ND::norm(a); },
+                [&]()
+                { return va.norm(); },
+                sameScalar);
+        }
+    }
+
+    // cvPoints holds the same coordinates as points in OpenCV's point type,
+    // Point2f for floating point and Point for pixel integers
+    template <typename T, typename P>
+    void compareGeometryType(
+        Comparer &comparer,
+        const std::string &type,
+        const std::string &distribution,
+        const NDArray<T, 2> &points,
+        const std::vector<P> &cvPoints,
+        double tolerance)
+    {
+        const auto n = points.shape()[0];
+
+        comparer.compare(
+            "computeConvexHull." + type, "cv.convexHull." + type, distribution, n, n,
+            [&]()
+            { return Geometry::computeConvexHull(points); },
+            [&]()
+            {
+                std::vector<P> hull;
+                cv::convexHull(cvPoints, hull);
+                return hull;
+            },
+            [&](const NDArray<T, 2> &ours, const std::vector<P> &theirs)
+            { return nearlyEqual(hullArea(ours), hullArea(theirs), tolerance); });
+
+        // Angles follow different conventions, the area is what both minimize
+        if (!(distribution == "circle" && n > (size_type{1} << 12) && !Geometry::PixelIntegral<T>))
+        {
+            comparer.compare(
+                "minAreaRectangle." + type, "cv.minAreaRect." + type, distribution, n, n,
+                [&]()
+                { return Geometry::minAreaRectangle(points); },
+                [&]()
+                { return cv::minAreaRect(cvPoints); },
+                [](const Geometry::RotatedRectangle &ours, const cv::RotatedRect &theirs)
+                {
+                    // OpenCV returns the rectangle in single precision
+                    return nearlyEqual(ours.size[0] * ours.size[1],
+                                 static_cast<double>(theirs.size.width) * static_cast<double>(theirs.size.height),
+                                 1e-4);
+                });
+        }
+
+        // Moments of the hull polygon
+        const auto hull = Geometry::computeConvexHull(points);
+        std::vector<P> cvHull;
+        cv::convexHull(cvPoints, cvHull);
+        comparer.compare(
+            "polygonMoments." + type, "cv.moments.contour." + type, distribution, n, hull.shape()[0],
+            [&]()
+            { return Geometry::polygonMoments(hull); },
+            [&]()
+            { return cv::moments(cvHull); },
+            [](const Geometry::Moments &ours, const cv::Moments &theirs)
+            { return sameMoments(ours, theirs, 1e-6); });
+    }
+
+    void compareGeometry(Comparer &comparer)
+    {
+        for (const auto distribution : {Distribution::Uniform, Distribution::Circle, Distribution::Clustered})
+        {
+            const std::string name = distributionName(distribution);
+            for (const size_type n : {size_type{1} << 10, size_type{1} << 14, size_type{1} << 18})
+            {
+                // Single precision coordinates so both libraries see the same values
+                auto points = makePoints(distribution, n);
+                std::vector<cv::Point2f> floatPoints(n);
+                for (size_type i = 0; i < n; ++i)
+                {
+                    floatPoints[i] = cv::Point2f(static_cast<float>(points(i, 0)), static_cast<float>(points(i, 1)));
+                    points(i, 0) = static_cast<double>(floatPoints[i].x);
+                    points(i, 1) = static_cast<double>(floatPoints[i].y);
+                }
+                compareGeometryType(comparer, "f64", name, points, floatPoints, 1e-9);
+
+                const auto pixels = convertPoints<std::int16_t>(points, 30000.0);
+                std::vector<cv::Point> pixelPoints(n);
+                for (size_type i = 0; i < n; ++i)
+                    pixelPoints[i] = cv::Point(pixels(i, 0), pixels(i, 1));
+                compareGeometryType(comparer, "i16", name, pixels, pixelPoints, 0.0);
+            }
+        }
+    }
+
+    // Masks of random disks, zero inside the disks
+    void compareImages(Comparer &comparer)
+    {
+        std::mt19937 rng(62);
+        for (const size_type side : {size_type{256}, size_type{1024}, size_type{2048}})
+        {
+            auto mask = NDArray<std::uint8_t, 2>::Full({side, side}, 255);
+            std::uniform_int_distribution<int> coordinate(0, static_cast<int>(side) - 1);
+            std::uniform_int_distribution<int> radius(1, static_cast<int>(side) / 32);
+            for (int disk = 0; disk < 64; ++disk)
+            {
+                const int cx = coordinate(rng);
+                const int cy = coordinate(rng);
+                const int r = radius(rng);
+                for (int y = std::max(0, cy - r); y <= std::min(static_cast<int>(side) - 1, cy + r); ++y)
+                {
+                    for (int x = std::max(0, cx - r); x <= std::min(static_cast<int>(side) - 1, cx + r); ++x)
+                    {
+                        if ((x - cx) * (x - cx) + (y - cy) * (y - cy) <= r * r)
+                            mask(static_cast<size_type>(y), static_cast<size_type>(x)) = 0;
+                    }
+                }
+            }
+
+            const auto rows = static_cast<int>(side);
+            const cv::Mat cvMask = cv::Mat(rows, rows, CV_8UC1, mask.data()).clone();
+            const auto pixels = side * side;
+
+            comparer.compare(
+                "distanceTransform", "cv.distanceTransform", "disks", side, pixels,
+                [&]()
+                { return Geometry::distanceTransform(mask); },
+                [&]()
+                {
+                    cv::Mat distance;
+                    cv::distanceTransform(cvMask, distance, cv::DIST_L2, cv::DIST_MASK_PRECISE);
+                    return distance;
+                },
+                [&](const NDArray<float, 2> &ours, const cv::Mat &theirs)
+                {
+                    for (int y = 0; y < rows; ++y)
+                    {
+                        for (int x = 0; x < rows; ++x)
+                        {
+                            const auto value = ours(static_cast<size_type>(y), static_cast<size_type>(x));
+                            if (!nearlyEqual(value, theirs.at<float>(y, x), 1e-5))
+                                return false;
+                        }
+                    }
+                    return true;
+                });
+
+            comparer.compare(
+                "imageMoments.binary", "cv.moments.binary", "disks", side, pixels,
+                [&]()
+                { return Geometry::imageMoments(mask, true); },
+                [&]()
+                { return cv::moments(cvMask, true); },
+                [](const Geometry::Moments &ours, const cv::Moments &theirs)
+                { return sameMoments(ours, theirs, 1e-9); });
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    Bench::Options options;
+    if (!Bench::parseOptions(argc, argv, options))
+        return 1;
+
+    Bench::Runner runner(options);
+    Comparer comparer(runner);
+    compareEigen(comparer);
+    compareGeometry(comparer);
+    compareImages(comparer);
+
+    const bool allMatch = comparer.summarize();
+    return (runner.finish() && allMatch) ? 0 : 1;
+}
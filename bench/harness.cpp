@@ -0,0 +1,233 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Sparsh Jain
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <numbers>
+#include <random>
+#include <thread>
+
+#include "harness.hpp"
+
+namespace Bench
+{
+    const char *distributionName(Distribution distribution)
+    {
+        switch (distribution)
+        {
+        case Distribution::Uniform:
+            return "uniform";
+        case Distribution::Circle:
+            return "circle";
+        case Distribution::Clustered:
+            return "clustered";
+        }
+        return "unknown";
+    }
+
+    NDArray<double, 2> makePoints(Distribution distribution, size_type n, std::uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+        std::normal_distribution<double> normal(0.0, 0.02);
+
+        // Cluster centers stay away from the border so points stay in range
+        constexpr size_type clusters = 8;
+        std::vector<std::pair<double, double>> centers;
+        for (size_type c = 0; c < clusters; ++c)
+            centers.emplace_back(0.8 * uniform(rng), 0.8 * uniform(rng));
+
+        auto points = NDArray<double, 2>::Empty({n, 2});
+        for (size_type i = 0; i < n; ++i)
+        {
+            switch (distribution)
+            {
+            case Distribution::Uniform:
+                points(i, 0) = uniform(rng);
+                points(i, 1) = uniform(rng);
+                break;
+            case Distribution::Circle:
+            {
+                const double angle = std::numbers::pi * uniform(rng);
+                points(i, 0) = std::cos(angle);
+                points(i, 1) = std::sin(angle);
+                break;
+            }
+            case Distribution::Clustered:
+            {
+                const auto &[cx, cy] = centers[rng() % clusters];
+                points(i, 0) = std::clamp(cx + normal(rng), -1.0, 1.0);
+                points(i, 1) = std::clamp(cy + normal(rng), -1.0, 1.0);
+                break;
+            }
+            }
+        }
+        return points;
+    }
+
+    bool parseOptions(int argc, char **argv, Options &options)
+    {
+        const auto usage = [argv]()
+        {
+            std::cerr << "usage: " << argv[0]
+                      << " [--min-time seconds] [--samples n] [--filter substring]"
+                      << " [--json path|-] [--label text] [--trace path]" << std::endl;
+            return false;
+        };
+
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string arg = argv[i];
+            if (arg == "--help" || arg == "-h" || i + 1 >= argc)
+                return usage();
+
+            const std::string value = argv[++i];
+            if (arg == "--min-time")
+                options.minTime = std::stod(value);
+            else if (arg == "--samples")
+                options.samples = std::max<size_type>(1, std::stoul(value));
+            else if (arg == "--filter")
+                options.filter = value;
+            else if (arg == "--json")
+                options.jsonPath = value;
+            else if (arg == "--label")
+                options.label = value;
+            else if (arg == "--trace")
+                options.tracePath = value;
+            else
+                return usage();
+        }
+        return true;
+    }
+
+    bool Runner::selected(const std::string &name) const
+    {
+        return m_options.filter.empty() || name.find(m_options.filter) != std::string::npos;
+    }
+
+    void Runner::record(Result result, std::vector<double> samples)
+    {
+        std::sort(samples.begin(), samples.end());
+        result.nsPerIteration = samples[samples.size() / 2];
+        result.minNsPerIteration = samples.front();
+        result.nsPerElement = result.nsPerIteration / static_cast<double>(std::max<size_type>(result.elements, 1));
+        result.elementsPerSecond = 1e9 * static_cast<double>(result.elements) / result.nsPerIteration;
+
+        std::cout << std::left << std::setw(48) << result.name << std::right
+                  << std::fixed << std::setprecision(3)
+                  << std::setw(14) << result.nsPerIteration / 1e3 << " us"
+                  << std::setw(10) << result.nsPerElement << " ns/elem"
+                  << std::setw(10) << result.elementsPerSecond / 1e6 << " M/s"
+                  << std::setprecision(1)
+                  << std::setw(10) << result.allocationsPerIteration << " allocs";
+        if constexpr (ND::allocationTrackingEnabled)
+        {
+            std::cout << std::setw(8) << result.ndarray.allocations << " nd allocs"
+                      << std::setw(8) << result.ndarray.copies << " copies"
+                      << std::setw(12) << result.ndarray.peakLiveBytes << " peak bytes";
+        }
+        std::cout << std::defaultfloat << std::endl;
+
+        m_results.push_back(std::move(result));
+    }
+
+    void Runner::writeJson(std::ostream &out) const
+    {
+        const auto quoted = [](const std::string &text)
+        {
+            std::string escaped = "\"";
+            for (const char c : text)
+            {
+                if (c == '"' || c == '\\')
+                    escaped += '\\';
+                escaped += c;
+            }
+            return escaped + "\"";
+        };
+
+        char date[32] = {};
+        const auto now = std::time(nullptr);
+        std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+
+        out << std::setprecision(17);
+        out << "{\n";
+        out << "  \"label\": " << quoted(m_options.label) << ",\n";
+        out << "  \"date\": " << quoted(date) << ",\n";
+        out << "  \"compiler\": " << quoted(__VERSION__) << ",\n";
+        out << "  \"hardware_threads\": " << std::max(1u, std::thread::hardware_concurrency()) << ",\n";
+        out << "  \"min_time\": " << m_options.minTime << ",\n";
+        out << "  \"samples\": " << m_options.samples << ",\n";
+        out << "  \"isa_level\": " << quoted(ND::Kernels::isaLevel()) << ",\n";
+        out << "  \"tracing\": " << (Trace::enabled ? "true" : "false") << ",\n";
+        out << "  \"ndarray_tracking\": " << (ND::allocationTrackingEnabled ? "true" : "false") << ",\n";
+        out << "  \"benchmarks\": [";
+        for (size_type i = 0; i < m_results.size(); ++i)
+        {
+            const auto &r = m_results[i];
+            out << (i == 0 ? "\n" : ",\n");
+            out << "    {\"name\": " << quoted(r.name)
+                << ", \"benchmark\": " << quoted(r.benchmark)
+                << ", \"distribution\": " << quoted(r.distribution)
+                << ", \"size\": " << r.size
+                << ", \"elements\": " << r.elements
+                << ", \"iterations\": " << r.iterations
+                << ", \"ns_per_iteration\": " << r.nsPerIteration
+                << ", \"min_ns_per_iteration\": " << r.minNsPerIteration
+                << ", \"ns_per_element\": " << r.nsPerElement
+                << ", \"elements_per_second\": " << r.elementsPerSecond
+                << ", \"allocations_per_iteration\": " << r.allocationsPerIteration
+                << ", \"bytes_per_iteration\": " << r.bytesPerIteration
+                << ", \"ndarray_allocations\": " << r.ndarray.allocations
+                << ", \"ndarray_bytes\": " << r.ndarray.bytes
+                << ", \"ndarray_copies\": " << r.ndarray.copies
+                << ", \"ndarray_peak_live_bytes\": " << r.ndarray.peakLiveBytes << "}";
+        }
+        out << "\n  ]\n}\n";
+    }
+
+    bool Runner::finish() const
+    {
+        if (!m_options.tracePath.empty())
+        {
+            if constexpr (!Trace::enabled)
+                std::cerr << "--trace ignored, build with make TRACE=1" << std::endl;
+            else
+            {
+                std::ofstream file(m_options.tracePath);
+                Trace::writeChromeTrace(file, m_trace);
+                if (!file)
+                {
+                    std::cerr << "Could not write " << m_options.tracePath << std::endl;
+                    return false;
+                }
+            }
+        }
+
+        if (m_options.jsonPath.empty())
+            return true;
+
+        if (m_options.jsonPath == "-")
+        {
+            writeJson(std::cout);
+            return true;
+        }
+
+        std::ofstream file(m_options.jsonPath);
+        writeJson(file);
+        if (!file)
+        {
+            std::cerr << "Could not write " << m_options.jsonPath << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+} // namespace Bench
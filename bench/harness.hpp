@@ -0,0 +1,190 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Sparsh Jain
+ *
+ */
+
+#ifndef BENCH_HARNESS_HPP
+#define BENCH_HARNESS_HPP
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include <cpp_eigen_opencv/shared/ndarray.hpp>
+#include <cpp_eigen_opencv/shared/allocation_tracking.hpp>
+#include <cpp_eigen_opencv/shared/trace.hpp>
+
+namespace Bench
+{
+    using ND::NDArray;
+    using ND::size_type;
+
+    // Allocations through the global operator new since program start,
+    // counted by the replacement operators in allocations.cpp
+    std::uint64_t allocationCount();
+    std::uint64_t allocatedBytes();
+
+    // Keeps the compiler from discarding a value that is never read
+    template <typename T>
+    inline void doNotOptimize(const T &value)
+    {
+        __asm__ __volatile__("" : : "r,m"(value) : "memory");
+    }
+
+    enum class Distribution
+    {
+        Uniform,   // uniform in a square
+        Circle,    // on a circle, every point is a hull vertex
+        Clustered, // a few tight gaussian clusters
+    };
+
+    const char *distributionName(Distribution distribution);
+
+    // n points in [-1, 1]^2 drawn from a distribution, fixed seed
+    NDArray<double, 2> makePoints(Distribution distribution, size_type n, std::uint32_t seed = 61);
+
+    // Points scaled by factor and rounded to T, e.g. to get pixel coordinates
+    template <typename T>
+    NDArray<T, 2> convertPoints(const NDArray<double, 2> &points, double factor)
+    {
+        auto result = NDArray<T, 2>::Empty(points.shape());
+        for (size_type i = 0; i < points.size(); ++i)
+            result[i] = static_cast<T>(std::lround(points[i] * factor));
+        return result;
+    }
+
+    struct Options
+    {
+        double minTime{0.2};     // seconds spent measuring each benchmark
+        size_type samples{5};    // timed samples, the median is reported
+        std::string filter{};    // only run benchmarks whose name contains this
+        std::string jsonPath{};  // write results as JSON here, - for stdout
+        std::string label{};     // free form tag stored in the JSON, e.g. a commit
+        std::string tracePath{}; // Chrome trace of the counted calls, needs ND_TRACE
+    };
+
+    // Parses --min-time, --samples, --filter, --json, --label and --trace
+    // Returns false and prints usage on bad arguments
+    bool parseOptions(int argc, char **argv, Options &options);
+
+    struct Result
+    {
+        std::string name{};         // benchmark/distribution/size
+        std::string benchmark{};
+        std::string distribution{};
+        size_type size{0};          // problem size
+        size_type elements{0};      // elements processed per iteration
+        size_type iterations{0};    // per timed sample
+        double nsPerIteration{0.0}; // median over samples
+        double minNsPerIteration{0.0};
+        double nsPerElement{0.0};
+        double elementsPerSecond{0.0};
+        double allocationsPerIteration{0.0};
+        double bytesPerIteration{0.0};
+        ND::AllocationStats ndarray{}; // one call, zero unless ND_TRACK_ALLOCATIONS
+    };
+
+    // Times callables and collects the results
+    // Every benchmark runs once to warm up and once to count allocations,
+    // both global and NDArray ones when tracking is compiled in, and
+    // traced when tracing is compiled in and a trace path is given,
+    // then the iteration count is doubled until one sample takes
+    // minTime / samples, and that many iterations are timed per sample.
+    class Runner final
+    {
+    private:
+        Options m_options;
+        std::vector<Result> m_results{};
+        std::vector<Trace::Event> m_trace{};
+
+        template <typename F>
+        static double timeIterations(F &f, size_type iterations)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            for (size_type i = 0; i < iterations; ++i)
+                f();
+            const auto stop = std::chrono::steady_clock::now();
+            return std::chrono::duration<double, std::nano>(stop - start).count();
+        }
+
+        bool selected(const std::string &name) const;
+
+        void record(Result result, std::vector<double> samples);
+
+    public:
+        explicit Runner(Options options)
+            : m_options(std::move(options))
+        {
+        }
+
+        // Runs f, which processes elements elements of a problem of the
+        // given size, if its name passes the filter
+        template <typename F>
+        void run(
+            const std::string &benchmark,
+            const std::string &distribution,
+            const size_type size,
+            const size_type elements,
+            F &&f)
+        {
+            Result result{};
+            result.benchmark = benchmark;
+            result.distribution = distribution;
+            result.size = size;
+            result.elements = elements;
+            result.name = benchmark + "/" + distribution + "/" + std::to_string(size);
+            if (!selected(result.name))
+                return;
+
+            f();
+
+            const bool traced = Trace::enabled && !m_options.tracePath.empty();
+            if (traced)
+                Trace::clear();
+
+            {
+                const ND::AllocationScope scope;
+                const auto allocations = allocationCount();
+                const auto bytes = allocatedBytes();
+                f();
+                result.allocationsPerIteration = static_cast<double>(allocationCount() - allocations);
+                result.bytesPerIteration = static_cast<double>(allocatedBytes() - bytes);
+                result.ndarray = scope.stats();
+            }
+
+            if (traced)
+            {
+                const auto events = Trace::events();
+                m_trace.insert(m_trace.end(), events.begin(), events.end());
+            }
+
+            const double target = 1e9 * m_options.minTime / static_cast<double>(m_options.samples);
+            size_type iterations = 1;
+            while (timeIterations(f, iterations) < target && iterations < (size_type{1} << 30))
+                iterations *= 2;
+
+            std::vector<double> samples;
+            for (size_type s = 0; s < m_options.samples; ++s)
+                samples.push_back(timeIterations(f, iterations) / static_cast<double>(iterations));
+
+            result.iterations = iterations;
+            record(std::move(result), std::move(samples));
+        }
+
+        inline const std::vector<Result> &results() const { return m_results; }
+
+        // One object per benchmark plus build metadata
+        void writeJson(std::ostream &out) const;
+
+        // Writes JSON and the trace to the paths given in the options, if any
+        bool finish() const;
+    };
+
+} // namespace Bench
+
+#endif /* BENCH_HARNESS_HPP */
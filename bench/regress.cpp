@@ -0,0 +1,425 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Sparsh Jain
+ *
+ */
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <cpp_eigen_opencv/shared/ndarray.hpp>
+#include <cpp_eigen_opencv/shared/kernels.hpp>
+#include <cpp_eigen_opencv/shared/parallel.hpp>
+#include <cpp_eigen_opencv/shared/geometry.hpp>
+#include <cpp_eigen_opencv/shared/calipers.hpp>
+#include <cpp_eigen_opencv/shared/moments.hpp>
+#include <cpp_eigen_opencv/shared/distance_transform.hpp>
+
+#include "harness.hpp"
+
+// Performance regression checks. Every algorithm runs at a small and a
+// large fixed size and fails on any of
+//   time     fastest ns per element above the median stored in the
+//            baseline by more than the tolerance, default 50%
+//   memory   more allocations per call than the baseline, or a count that
+//            grows with the size, none of the algorithms allocate per
+//            element
+//   growth   time growing faster than the declared complexity between the
+//            two sizes, e.g. an O(n log n) routine turning quadratic
+// The growth check compares two runs on the same machine, so it holds
+// on any host. The time and memory budgets are only meaningful on the
+// machine that wrote the baseline, --update rewrites it.
+
+namespace
+{
+    using namespace Bench;
+
+    // The baseline stores the median sample and a check compares the
+    // fastest one against it, so a run has to be slower in every sample
+    // to fail, not just unlucky in one
+    double fastestNsPerElement(const Result &result)
+    {
+        return result.minNsPerIteration / static_cast<double>(std::max<size_type>(result.elements, 1));
+    }
+
+    struct Budget
+    {
+        double nsPerElement{0.0};
+        double allocations{0.0};
+    };
+
+    struct Baseline
+    {
+        size_type threads{0}; // hardware threads of the host that wrote it
+        std::map<std::string, Budget> budgets{};
+    };
+
+    // Lines of "name median_ns_per_element allocations", # starts a comment,
+    // plus one "threads n" line
+    bool readBaseline(const std::string &path, Baseline &baseline)
+    {
+        std::ifstream file(path);
+        if (!file)
+            return false;
+
+        std::string line;
+        while (std::getline(file, line))
+        {
+            std::istringstream fields(line.substr(0, line.find('#')));
+            std::string name;
+            if (!(fields >> name))
+                continue;
+
+            if (name == "threads")
+            {
+                fields >> baseline.threads;
+                continue;
+            }
+
+            Budget budget{};
+            if (fields >> budget.nsPerElement >> budget.allocations)
+                baseline.budgets[name] = budget;
+        }
+        return true;
+    }
+
+    bool writeBaseline(const std::string &path, const Baseline &baseline)
+    {
+        std::ofstream file(path);
+        file << "# Written by regress --update, one line per benchmark:\n"
+             << "# name median_ns_per_element allocations_per_call\n"
+             << "# compiler " << __VERSION__ << ", " << ND::Kernels::isaLevel() << "\n"
+             << "threads " << baseline.threads << "\n";
+        for (const auto &[name, budget] : baseline.budgets)
+            file << name << " " << std::setprecision(4) << budget.nsPerElement << " " << budget.allocations << "\n";
+        return static_cast<bool>(file);
+    }
+
+    struct RegressOptions
+    {
+        std::string baselinePath{"bench/baseline.txt"};
+        double tolerance{0.5}; // allowed slowdown over the baseline, 0.5 is 50%
+        bool update{false};    // rewrite the baseline instead of checking it
+    };
+
+    class Checker final
+    {
+    private:
+        Runner &m_runner;
+        const RegressOptions &m_options;
+        const Baseline &m_baseline;
+        bool m_sameHost;
+        std::vector<std::string> m_failures{};
+
+        void fail(const std::string &message)
+        {
+            std::cerr << "FAIL " << message << std::endl;
+            m_failures.push_back(message);
+        }
+
+        void checkBudget(const Result &result)
+        {
+            const auto found = m_baseline.budgets.find(result.name);
+            if (found == m_baseline.budgets.end())
+            {
+                std::cerr << "no baseline for " << result.name << std::endl;
+                return;
+            }
+
+            const auto &budget = found->second;
+            const double limit = budget.nsPerElement * (1.0 + m_options.tolerance);
+            const double measured = fastestNsPerElement(result);
+            if (measured > limit)
+            {
+                std::ostringstream message;
+                message << result.name << ": " << std::setprecision(4) << measured
+                        << " ns/elem, budget " << limit;
+                fail(message.str());
+            }
+
+            // Thread pools allocate per worker, so the counts only carry
+            // over between hosts with the same number of threads
+            if (m_sameHost && result.allocationsPerIteration > budget.allocations)
+            {
+                std::ostringstream message;
+                message << result.name << ": " << result.allocationsPerIteration
+                        << " allocations per call, budget " << budget.allocations;
+                fail(message.str());
+            }
+        }
+
+        void checkGrowth(const Result &small, const Result &large, double maxExponent)
+        {
+            const double exponent = std::log(large.minNsPerIteration / small.minNsPerIteration) /
+                                    std::log(static_cast<double>(large.elements) / static_cast<double>(small.elements));
+            std::cout << std::left << std::setw(48) << (large.benchmark + "/" + large.distribution) << std::right
+                      << std::fixed << std::setprecision(2)
+                      << "  time ~ n^" << exponent << ", limit n^" << maxExponent
+                      << std::defaultfloat << std::endl;
+            if (exponent > maxExponent)
+            {
+                std::ostringstream message;
+                message << large.benchmark << "/" << large.distribution << ": time grows as n^"
+                        << std::setprecision(3) << exponent << ", limit n^" << maxExponent;
+                fail(message.str());
+            }
+
+            // Growing vectors add a few allocations per doubling and chunked
+            // parallel loops may start more workers on more data, anything
+            // per element is far beyond twice the count
+            const auto slack = 2.0 * static_cast<double>(Parallel::hardwareThreads());
+            if (large.allocationsPerIteration > 2.0 * small.allocationsPerIteration + slack)
+            {
+                std::ostringstream message;
+                message << large.benchmark << "/" << large.distribution << ": allocations grow from "
+                        << small.allocationsPerIteration << " to " << large.allocationsPerIteration;
+                fail(message.str());
+            }
+        }
+
+    public:
+        Checker(Runner &runner, const RegressOptions &options, const Baseline &baseline)
+            : m_runner(runner),
+              m_options(options),
+              m_baseline(baseline),
+              m_sameHost(baseline.threads == Parallel::hardwareThreads())
+        {
+            if (!m_options.update && !m_baseline.budgets.empty() && !m_sameHost)
+                std::cerr << "baseline written on a host with " << m_baseline.threads
+                          << " threads, skipping allocation budgets" << std::endl;
+        }
+
+        // Runs make(n)() at both sizes and checks the results. n counts
+        // the elements processed per call, points or pixels.
+        template <typename Make>
+        void check(
+            const std::string &benchmark,
+            const std::string &distribution,
+            const size_type small,
+            const size_type large,
+            const double maxExponent,
+            Make &&make)
+        {
+            const auto before = m_runner.results().size();
+            for (const auto n : {small, large})
+                m_runner.run(benchmark, distribution, n, n, make(n));
+
+            const auto &results = m_runner.results();
+            if (m_options.update)
+            {
+                if (results.size() == before + 2)
+                    checkGrowth(results[before], results[before + 1], maxExponent);
+                return;
+            }
+
+            for (auto i = before; i < results.size(); ++i)
+                checkBudget(results[i]);
+            if (results.size() == before + 2)
+                checkGrowth(results[before], results[before + 1], maxExponent);
+        }
+
+        // Prints the failures and returns whether there were none
+        bool summarize() const
+        {
+            if (m_failures.empty())
+            {
+                std::cout << "\nAll budgets met" << std::endl;
+                return true;
+            }
+
+            std::cout << "\n"
+                      << m_failures.size() << " budget(s) exceeded:" << std::endl;
+            for (const auto &failure : m_failures)
+                std::cout << "  " << failure << std::endl;
+            return false;
+        }
+    };
+
+    // n log n between 2^12 and 2^16 elements is n^1.10, the limit leaves
+    // room for cache effects and noise and still catches n^2
+    constexpr double NLogN = 1.4;
+    constexpr double Linear = 1.35;
+
+    template <typename T>
+    void checkGeometry(Checker &checker, const std::string &type, double factor, Distribution distribution)
+    {
+        const std::string name = distributionName(distribution);
+        const auto points = [distribution, factor](size_type n)
+        {
+            return convertPoints<T>(makePoints(distribution, n), factor);
+        };
+
+        checker.check("argSortPoints." + type, name, 1 << 12, 1 << 16, NLogN, [&](size_type n)
+                      { return [p = points(n)]()
+                        { doNotOptimize(Geometry::argSortPoints(p)); }; });
+        checker.check("computeConvexHull." + type, name, 1 << 12, 1 << 16, NLogN, [&](size_type n)
+                      { return [p = points(n)]()
+                        { doNotOptimize(Geometry::computeConvexHull(p)); }; });
+        checker.check("minAreaRectangle." + type, name, 1 << 12, 1 << 16, NLogN, [&](size_type n)
+                      { return [p = points(n)]()
+                        { doNotOptimize(Geometry::minAreaRectangle(p)); }; });
+    }
+
+    void checkPoints(Checker &checker)
+    {
+        checkGeometry<double>(checker, "f64", 1.0, Distribution::Uniform);
+        checkGeometry<double>(checker, "f64", 1.0, Distribution::Clustered);
+        checkGeometry<std::int16_t>(checker, "i16", 30000.0, Distribution::Uniform);
+
+        // The floating point rectangle is quadratic in the hull size by
+        // design, the exact integer one must stay linear in it even when
+        // every point is on the hull
+        checkGeometry<std::int16_t>(checker, "i16", 30000.0, Distribution::Circle);
+
+        checker.check("closestPair.f64", "uniform", 1 << 12, 1 << 16, NLogN, [](size_type n)
+                      { return [p = makePoints(Distribution::Uniform, n), workspace = std::vector<size_type>(2 * n)]() mutable
+                        { doNotOptimize(Geometry::closestPair(p, workspace)); }; });
+        checker.check("pointMoments.f64", "uniform", 1 << 12, 1 << 16, Linear, [](size_type n)
+                      { return [p = makePoints(Distribution::Uniform, n)]()
+                        { doNotOptimize(Geometry::pointMoments(p)); }; });
+    }
+
+    // side x side mask of random disks, zero inside the disks
+    NDArray<std::uint8_t, 2> makeDisks(size_type side)
+    {
+        std::mt19937 rng(68);
+        auto mask = NDArray<std::uint8_t, 2>::Full({side, side}, 255);
+        const auto last = static_cast<int>(side) - 1;
+        std::uniform_int_distribution<int> coordinate(0, last);
+        std::uniform_int_distribution<int> radius(1, static_cast<int>(side) / 32);
+        for (int disk = 0; disk < 64; ++disk)
+        {
+            const int cx = coordinate(rng);
+            const int cy = coordinate(rng);
+            const int r = radius(rng);
+            for (int y = std::max(0, cy - r); y <= std::min(last, cy + r); ++y)
+            {
+                for (int x = std::max(0, cx - r); x <= std::min(last, cx + r); ++x)
+                {
+                    if ((x - cx) * (x - cx) + (y - cy) * (y - cy) <= r * r)
+                        mask(static_cast<size_type>(y), static_cast<size_type>(x)) = 0;
+                }
+            }
+        }
+        return mask;
+    }
+
+    void checkImages(Checker &checker)
+    {
+        const auto mask = [](size_type pixels)
+        {
+            return makeDisks(static_cast<size_type>(std::lround(std::sqrt(static_cast<double>(pixels)))));
+        };
+
+        checker.check("distanceTransform", "disks", 128 * 128, 512 * 512, Linear, [&](size_type n)
+                      { return [m = mask(n)]()
+                        { doNotOptimize(Geometry::distanceTransform(m)); }; });
+        checker.check("imageMoments.binary", "disks", 128 * 128, 512 * 512, Linear, [&](size_type n)
+                      { return [m = mask(n)]()
+                        { doNotOptimize(Geometry::imageMoments(m, true)); }; });
+    }
+
+    void checkNDArray(Checker &checker)
+    {
+        const auto vector = [](size_type n)
+        {
+            auto a = NDArray<double, 1>::Empty({n});
+            for (size_type i = 0; i < n; ++i)
+                a[i] = 1.0 + static_cast<double>(i % 97);
+            return a;
+        };
+
+        checker.check("ndarray.add", "dense", 1 << 12, 1 << 16, Linear, [&](size_type n)
+                      { return [a = vector(n), b = vector(n)]()
+                        { doNotOptimize(a + b); }; });
+        checker.check("ndarray.dot", "dense", 1 << 12, 1 << 16, Linear, [&](size_type n)
+                      { return [a = vector(n), b = vector(n)]()
+                        { doNotOptimize(ND::dot(a, b)); }; });
+    }
+
+    // Whole string as a finite non-negative fraction, no trailing text
+    bool parseTolerance(const std::string &text, double &value)
+    {
+        const auto *last = text.data() + text.size();
+        double parsed = 0.0;
+        const auto [next, error] = std::from_chars(text.data(), last, parsed);
+        if (error != std::errc{} || next != last || !std::isfinite(parsed) || parsed < 0.0)
+            return false;
+        value = parsed;
+        return true;
+    }
+
+    // Splits off --baseline, --tolerance and --update, the rest goes to
+    // Bench::parseOptions, which prints the usage for a bad tolerance
+    bool parseRegressOptions(int argc, char **argv, RegressOptions &regress, Options &options)
+    {
+        std::vector<char *> rest{argv[0]};
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string arg = argv[i];
+            if (arg == "--update")
+                regress.update = true;
+            else if (arg == "--baseline" && i + 1 < argc)
+                regress.baselinePath = argv[++i];
+            else if (arg == "--tolerance" && i + 1 < argc && parseTolerance(argv[i + 1], regress.tolerance))
+                ++i;
+            else
+                rest.push_back(argv[i]);
+        }
+
+        if (!parseOptions(static_cast<int>(rest.size()), rest.data(), options))
+        {
+            std::cerr << "       [--baseline path] [--tolerance fraction] [--update]" << std::endl;
+            return false;
+        }
+        return true;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    RegressOptions regress;
+    Bench::Options options;
+    if (!parseRegressOptions(argc, argv, regress, options))
+        return 1;
+
+    // An update keeps the entries a --filter run did not measure
+    Baseline baseline;
+    if (!readBaseline(regress.baselinePath, baseline) && !regress.update)
+    {
+        std::cerr << "Could not read " << regress.baselinePath << ", run with --update to write it" << std::endl;
+        return 1;
+    }
+
+    Bench::Runner runner(options);
+    Checker checker(runner, regress, baseline);
+    checkNDArray(checker);
+    checkPoints(checker);
+    checkImages(checker);
+
+    if (regress.update)
+    {
+        baseline.threads = Parallel::hardwareThreads();
+        for (const auto &r : runner.results())
+            baseline.budgets[r.name] = {r.nsPerElement, r.allocationsPerIteration};
+    }
+    if (regress.update && !writeBaseline(regress.baselinePath, baseline))
+    {
+        std::cerr << "Could not write " << regress.baselinePath << std::endl;
+        return 1;
+    }
+
+    const bool passed = checker.summarize();
+    return (runner.finish() && passed) ? 0 : 1;
+}
@@ -0,0 +1,108 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Sparsh Jain
+ *
+ */
+
+#ifndef INCLUDE_CPP_EIGEN_OPENCV_SHARED_ALLOCATION_TRACKING_HPP
+#define INCLUDE_CPP_EIGEN_OPENCV_SHARED_ALLOCATION_TRACKING_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <cpp_eigen_opencv/shared/small_pool.hpp>
+
+// Opt-in counting of NDArray buffer allocations
+// Build everything with -DND_TRACK_ALLOCATIONS (make TRACK_ALLOCATIONS=1)
+// to enable it. Without it NDArray allocates through std::make_shared, or
+// the small block pool for tiny arrays, and every counter stays zero. The
+// macro changes NDArray itself, so it must be the same in every
+// translation unit.
+
+namespace ND
+{
+#ifdef ND_TRACK_ALLOCATIONS
+    inline constexpr bool allocationTrackingEnabled = true;
+#else
+    inline constexpr bool allocationTrackingEnabled = false;
+#endif
+
+    struct AllocationStats
+    {
+        std::uint64_t allocations{0};   // owning buffers created
+        std::uint64_t deallocations{0}; // owning buffers released
+        std::uint64_t bytes{0};         // bytes requested by those buffers
+        std::uint64_t copies{0};        // deep copies, Copy() and copy-on-write
+        std::int64_t liveBytes{0};      // allocated minus released
+        std::uint64_t peakLiveBytes{0}; // highest liveBytes reached
+    };
+
+    std::ostream &operator<<(std::ostream &out, const AllocationStats &stats);
+
+    // Totals since program start
+    AllocationStats allocationStats();
+
+    // Counts what happens between construction and stats()
+    // liveBytes is the net change, so it is negative when the scope
+    // released older buffers, and peakLiveBytes is the highest net
+    // change reached. Scopes nest and see allocations from all threads.
+    class AllocationScope final
+    {
+    private:
+        AllocationStats m_start;
+        std::uint64_t m_peak{0}; // guarded by the scope registry
+
+    public:
+        AllocationScope();
+        ~AllocationScope();
+
+        AllocationScope(const AllocationScope &) = delete;
+        AllocationScope &operator=(const AllocationScope &) = delete;
+        AllocationScope(AllocationScope &&) = delete;
+        AllocationScope &operator=(AllocationScope &&) = delete;
+
+        AllocationStats stats() const;
+
+        // Called with the registry locked
+        void observeLiveBytes(std::int64_t liveBytes);
+    };
+
+    namespace Detail
+    {
+        void recordAllocation(std::size_t bytes);
+        void recordDeallocation(std::size_t bytes);
+        void recordCopy();
+
+        // Value-initialized buffer of n elements for an owning NDArray
+        template <typename T>
+        std::shared_ptr<T[]> allocateArray(const std::size_t n)
+        {
+#ifdef ND_TRACK_ALLOCATIONS
+            const auto bytes = n * sizeof(T);
+            std::shared_ptr<T[]> data(new T[n](), [bytes](T *p)
+                                      {
+                                          recordDeallocation(bytes);
+                                          delete[] p; });
+            recordAllocation(bytes);
+            return data;
+#else
+            // A limit of 0 leaves every array, empty ones too, to the heap
+            if constexpr (smallArraySize != 0)
+            {
+                if (n <= smallArraySize)
+                    return std::allocate_shared<T[]>(SmallBlockAllocator<T>{}, n);
+            }
+            return std::make_shared<T[]>(n);
+#endif
+        }
+    }
+
+    /**************************************************************************/
+
+    void testAllocationTracking();
+
+}
+
+#endif /* INCLUDE_CPP_EIGEN_OPENCV_SHARED_ALLOCATION_TRACKING_HPP */
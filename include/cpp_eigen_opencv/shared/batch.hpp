@@ -0,0 +1,122 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Sparsh Jain
+ *
+ */
+
+#ifndef INCLUDE_CPP_EIGEN_OPENCV_SHARED_BATCH_HPP
+#define INCLUDE_CPP_EIGEN_OPENCV_SHARED_BATCH_HPP
+
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <variant>
+#include <vector>
+#include <cpp_eigen_opencv/shared/ndarray.hpp>
+
+// Headless batch driver: loads point sets and images from files, runs a
+// pipeline of geometry stages over them on worker threads and writes one
+// line per input and stage, followed by throughput and latency numbers.
+//
+// Inputs are recognised by extension:
+//   .txt, .csv, .xy  text points, one "x y" or "x,y" pair per line, # comments
+//   .bin             raw interleaved float64 x, y pairs
+//   .pgm             8-bit binary (P5) or ASCII (P2) grayscale image
+//   .npy             NumPy array, uint8 rows x cols as an image, any other
+//                    dtype with shape (n, 2) as points
+// Other files go to the image loader given in the options, if any.
+
+namespace Batch
+{
+    using ND::NDArray;
+    using ND::size_type;
+
+    enum class Stage
+    {
+        Hull,              // convex hull vertex count and area
+        Rectangle,         // minimum area rectangle
+        Diameter,          // farthest pair of hull vertices
+        Width,             // minimum width of the hull
+        ClosestPair,       // closest pair of points
+        Moments,           // centroid and first Hu invariants
+        DistanceTransform, // images only, largest distance to a zero pixel
+    };
+
+    const char *stageName(Stage stage);
+
+    // Comma separated stage names, e.g. "hull,rect,moments", or "all"
+    bool parseStages(const std::string &list, std::vector<Stage> &stages);
+
+    // Points are rows of x, y. The geometry stages of an image run on the
+    // coordinates of its nonzero pixels, x along columns.
+    using Data = std::variant<NDArray<double, 2>, NDArray<std::uint8_t, 2>>;
+
+    // Fills image and returns true if it could read path
+    using ImageLoader = std::function<bool(const std::string &path, NDArray<std::uint8_t, 2> &image)>;
+
+    struct Options
+    {
+        std::vector<Stage> stages{};       // in the order they run
+        size_type threads{0};              // worker threads, 0 for all hardware threads
+        size_type repeat{1};               // passes over the inputs, for end to end timing
+        std::string outputPath{};          // results go here, stdout if empty
+        bool quiet{false};                 // skip writing results, only print statistics
+        std::vector<std::string> inputs{}; // files, directories are expanded by parseOptions
+        ImageLoader imageLoader{};         // fallback for unknown extensions
+    };
+
+    // Parses the arguments after "batch"
+    // Returns false and prints usage on bad arguments
+    bool parseOptions(int argc, char **argv, Options &options);
+
+    // Readers for the formats above, empty on malformed input
+    std::optional<NDArray<double, 2>> readTextPoints(std::istream &in);
+    std::optional<NDArray<double, 2>> readBinaryPoints(std::istream &in);
+    std::optional<NDArray<std::uint8_t, 2>> readPgm(std::istream &in);
+    std::optional<Data> readNpyData(std::istream &in);
+
+    // Loads path by extension, falls back to the image loader
+    std::optional<Data> load(const std::string &path, const ImageLoader &imageLoader = {});
+
+    // Runs the stages on data and returns their result lines, each
+    // prefixed with name. Stages that do not apply to data are skipped.
+    std::string process(const std::string &name, const Data &data, const std::vector<Stage> &stages);
+
+    struct Statistics
+    {
+        size_type inputs{0};   // processed, counting every repeat
+        size_type failures{0}; // inputs that could not be loaded or processed
+        size_type elements{0}; // points or pixels processed
+        double seconds{0.0};   // wall time of the whole run
+        double meanLatency{0.0};
+        double p50Latency{0.0}; // seconds per input, load and process
+        double p90Latency{0.0};
+        double p99Latency{0.0};
+        double maxLatency{0.0};
+        bool outputFailed{false}; // results could not be written, nothing ran if the file did not open
+    };
+
+    std::ostream &operator<<(std::ostream &out, const Statistics &statistics);
+
+    // Loads and processes every input on options.threads workers, writes
+    // the results in input order and returns the statistics. An input that
+    // cannot be read, or throws while loading or processing, counts as a
+    // failure and gets an error line.
+    Statistics run(const Options &options);
+
+    // parseOptions and run, prints the statistics to stderr
+    // Returns the exit code, 1 if any input failed or the results could
+    // not be written
+    int main(int argc, char **argv, ImageLoader imageLoader = {});
+
+    /**************************************************************************/
+
+    void testBatch();
+
+} // namespace Batch
+
+#endif /* INCLUDE_CPP_EIGEN_OPENCV_SHARED_BATCH_HPP */
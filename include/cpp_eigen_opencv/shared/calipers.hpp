@@ -0,0 +1,271 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Sparsh Jain
+ *
+ */
+
+#ifndef INCLUDE_CPP_EIGEN_OPENCV_SHARED_CALIPERS_HPP
+#define INCLUDE_CPP_EIGEN_OPENCV_SHARED_CALIPERS_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <vector>
+#include <cpp_eigen_opencv/shared/ndarray.hpp>
+#include <cpp_eigen_opencv/shared/geometry.hpp>
+#include <cpp_eigen_opencv/shared/trace.hpp>
+
+namespace Geometry
+{
+    // Pair of rows of a point array and their distance
+    struct PointPair
+    {
+        size_type first;
+        size_type second;
+        double distance;
+    };
+
+    // Width of a convex polygon in the direction normal to one of its edges
+    struct PolygonWidth
+    {
+        double width;
+        size_type edge;   // edge from vertex edge to vertex edge + 1
+        size_type vertex; // vertex farthest from that edge
+    };
+
+    namespace Detail
+    {
+        // Twice the signed area of triangle (a, b, c) of rows of points
+        template <Arithmetic T>
+        inline double doubleArea(
+            const NDArray<T, 2> &points,
+            size_type a,
+            size_type b,
+            size_type c)
+        {
+            const double abx = static_cast<double>(points(b, 0)) - static_cast<double>(points(a, 0));
+            const double aby = static_cast<double>(points(b, 1)) - static_cast<double>(points(a, 1));
+            const double acx = static_cast<double>(points(c, 0)) - static_cast<double>(points(a, 0));
+            const double acy = static_cast<double>(points(c, 1)) - static_cast<double>(points(a, 1));
+            return abx * acy - aby * acx;
+        }
+
+        template <Arithmetic T>
+        inline double distanceSquared(
+            const NDArray<T, 2> &points,
+            size_type a,
+            size_type b)
+        {
+            const double dx = static_cast<double>(points(a, 0)) - static_cast<double>(points(b, 0));
+            const double dy = static_cast<double>(points(a, 1)) - static_cast<double>(points(b, 1));
+            return dx * dx + dy * dy;
+        }
+
+        // Divide and conquer on idx[lo, hi) sorted by x
+        // Leaves idx[lo, hi) sorted by y, buffer is scratch of the same size
+        template <Arithmetic T>
+        void closestPairRange(
+            const NDArray<T, 2> &points,
+            std::span<size_type> idx,
+            std::span<size_type> buffer,
+            size_type lo,
+            size_type hi,
+            PointPair &best,
+            double &bestSquared)
+        {
+            const auto byY = [&points](size_type a, size_type b)
+            { return points(a, 1) < points(b, 1); };
+
+            if (hi - lo <= 3)
+            {
+                for (size_type i = lo; i < hi; ++i)
+                {
+                    for (size_type j = i + 1; j < hi; ++j)
+                    {
+                        const auto d2 = distanceSquared(points, idx[i], idx[j]);
+                        if (d2 < bestSquared)
+                        {
+                            bestSquared = d2;
+                            best = {idx[i], idx[j], 0.0};
+                        }
+                    }
+                }
+
+                std::sort(idx.begin() + static_cast<std::ptrdiff_t>(lo),
+                          idx.begin() + static_cast<std::ptrdiff_t>(hi), byY);
+                return;
+            }
+
+            const auto mid = lo + (hi - lo) / 2;
+            const auto midX = static_cast<double>(points(idx[mid], 0));
+
+            closestPairRange(points, idx, buffer, lo, mid, best, bestSquared);
+            closestPairRange(points, idx, buffer, mid, hi, best, bestSquared);
+
+            std::merge(idx.begin() + static_cast<std::ptrdiff_t>(lo),
+                       idx.begin() + static_cast<std::ptrdiff_t>(mid),
+                       idx.begin() + static_cast<std::ptrdiff_t>(mid),
+                       idx.begin() + static_cast<std::ptrdiff_t>(hi),
+                       buffer.begin() + static_cast<std::ptrdiff_t>(lo), byY);
+            std::copy(buffer.begin() + static_cast<std::ptrdiff_t>(lo),
+                      buffer.begin() + static_cast<std::ptrdiff_t>(hi),
+                      idx.begin() + static_cast<std::ptrdiff_t>(lo));
+
+            // Points closer than the best distance to the dividing line,
+            // in y order, only need to be checked against their successors
+            // until the y gap exceeds the best distance
+            size_type strip = lo;
+            for (size_type i = lo; i < hi; ++i)
+            {
+                const double dx = static_cast<double>(points(idx[i], 0)) - midX;
+                if (dx * dx >= bestSquared)
+                    continue;
+
+                for (size_type j = strip; j-- > lo;)
+                {
+                    const double dy = static_cast<double>(points(idx[i], 1)) -
+                                      static_cast<double>(points(buffer[j], 1));
+                    if (dy * dy >= bestSquared)
+                        break;
+
+                    const auto d2 = distanceSquared(points, idx[i], buffer[j]);
+                    if (d2 < bestSquared)
+                    {
+                        bestSquared = d2;
+                        best = {buffer[j], idx[i], 0.0};
+                    }
+                }
+
+                buffer[strip++] = idx[i];
+            }
+        }
+    }
+
+    // Farthest pair of vertices (the diameter) of a convex polygon in
+    // counter-clockwise order, such as the output of computeConvexHull
+    // Rotating calipers, O(h) and allocation free
+    template <Arithmetic T>
+    PointPair farthestPair(const NDArray<T, 2> &hull)
+    {
+        TRACE_SCOPE("calipers.farthestPair");
+        const auto n = hull.shape()[0];
+        if (n < 2)
+            return {0, 0, 0.0};
+
+        PointPair best{0, 1, Detail::distanceSquared(hull, 0, 1)};
+        const auto consider = [&](size_type a, size_type b)
+        {
+            const auto d2 = Detail::distanceSquared(hull, a, b);
+            if (d2 > best.distance)
+                best = {a, b, d2};
+        };
+
+        // For every edge, advance the antipodal vertex while it gets
+        // farther from the edge, it never moves backwards
+        size_type j = 1;
+        for (size_type i = 0; i < n; ++i)
+        {
+            const auto next = (i + 1) % n;
+            while (Detail::doubleArea(hull, i, next, (j + 1) % n) >
+                   Detail::doubleArea(hull, i, next, j))
+            {
+                j = (j + 1) % n;
+            }
+
+            consider(i, j);
+            consider(next, j);
+        }
+
+        best.distance = std::sqrt(best.distance);
+        return best;
+    }
+
+    // Minimum width of a convex polygon in counter-clockwise order
+    // The minimum is always attained normal to one of the edges
+    // Rotating calipers, O(h) and allocation free
+    template <Arithmetic T>
+    PolygonWidth minimumWidth(const NDArray<T, 2> &hull)
+    {
+        TRACE_SCOPE("calipers.minimumWidth");
+        const auto n = hull.shape()[0];
+        if (n < 3)
+            return {0.0, 0, 0};
+
+        PolygonWidth best{std::numeric_limits<double>::infinity(), 0, 0};
+
+        size_type j = 1;
+        for (size_type i = 0; i < n; ++i)
+        {
+            const auto next = (i + 1) % n;
+            while (Detail::doubleArea(hull, i, next, (j + 1) % n) >
+                   Detail::doubleArea(hull, i, next, j))
+            {
+                j = (j + 1) % n;
+            }
+
+            const double edgeLength = std::sqrt(Detail::distanceSquared(hull, i, next));
+            if (edgeLength <= 0.0)
+                continue;
+
+            const double width = Detail::doubleArea(hull, i, next, j) / edgeLength;
+            if (width < best.width)
+                best = {width, i, j};
+        }
+
+        return best;
+    }
+
+    // Closest pair among the first count rows of points, all if count < 0
+    // Divide and conquer, O(n log n); workspace must hold 2 * count indices
+    // and is the only memory used. Returns distance infinity for fewer
+    // than two points.
+    template <Arithmetic T>
+    PointPair closestPair(
+        const NDArray<T, 2> &points,
+        std::span<size_type> workspace,
+        const int count = -1)
+    {
+        TRACE_SCOPE("calipers.closestPair");
+        const auto N = (count < 0) ? points.shape()[0] : static_cast<size_type>(count);
+        assert(N <= points.shape()[0]);
+        assert(workspace.size() >= 2 * N && "Workspace too small");
+
+        PointPair best{0, 0, std::numeric_limits<double>::infinity()};
+        if (N < 2)
+            return best;
+
+        auto idx = workspace.first(N);
+        auto buffer = workspace.subspan(N, N);
+        std::iota(idx.begin(), idx.end(), 0);
+        std::sort(idx.begin(), idx.end(), [&points](size_type a, size_type b)
+                  { return points(a, 0) < points(b, 0); });
+
+        double bestSquared = std::numeric_limits<double>::infinity();
+        Detail::closestPairRange(points, idx, buffer, 0, N, best, bestSquared);
+
+        if (best.first > best.second)
+            std::swap(best.first, best.second);
+        best.distance = std::sqrt(bestSquared);
+        return best;
+    }
+
+    template <Arithmetic T>
+    PointPair closestPair(
+        const NDArray<T, 2> &points,
+        const int count = -1)
+    {
+        const auto N = (count < 0) ? points.shape()[0] : static_cast<size_type>(count);
+        std::vector<size_type> workspace(2 * N);
+        return closestPair(points, std::span<size_type>(workspace), count);
+    }
+
+    /**************************************************************************/
+
+    void testCalipers();
+
+} // namespace Geometry
+
+#endif /* INCLUDE_CPP_EIGEN_OPENCV_SHARED_CALIPERS_HPP */
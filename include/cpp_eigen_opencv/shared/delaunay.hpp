@@ -0,0 +1,112 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Sparsh Jain
+ *
+ */
+
+#ifndef INCLUDE_CPP_EIGEN_OPENCV_SHARED_DELAUNAY_HPP
+#define INCLUDE_CPP_EIGEN_OPENCV_SHARED_DELAUNAY_HPP
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include <cpp_eigen_opencv/shared/ndarray.hpp>
+#include <cpp_eigen_opencv/shared/geometry.hpp>
+
+namespace Geometry
+{
+    // Delaunay triangulation stored as a compact half-edge structure
+    // Triangle t owns half-edges 3t, 3t + 1, 3t + 2; half-edge e starts at
+    // point triangles[e] and ends at the start of nextHalfedge(e).
+    // halfedges[e] is the opposite half-edge in the neighboring triangle,
+    // or NoHalfedge on the convex hull. Triangles are counter-clockwise.
+    struct DelaunayTriangulation
+    {
+        static constexpr size_type NoHalfedge = std::numeric_limits<size_type>::max();
+
+        std::vector<size_type> triangles{}; // point index per half-edge
+        std::vector<size_type> halfedges{}; // opposite half-edge per half-edge
+        std::vector<size_type> hull{};      // hull points, counter-clockwise,
+                                            // starting at the smallest (x, y),
+                                            // collinear hull points included
+
+        inline size_type numTriangles() const { return triangles.size() / 3; }
+
+        static inline constexpr size_type nextHalfedge(size_type e)
+        {
+            return (e % 3 == 2) ? e - 2 : e + 1;
+        }
+
+        static inline constexpr size_type prevHalfedge(size_type e)
+        {
+            return (e % 3 == 0) ? e + 2 : e - 1;
+        }
+    };
+
+    // Voronoi diagram dual to a Delaunay triangulation
+    // Voronoi vertex t is the circumcenter of triangle t. The cell of point i
+    // is cellVertices[cellOffsets[i] .. cellOffsets[i + 1]) in
+    // counter-clockwise order. Cells of hull points are unbounded: their
+    // vertex chain is open and both ends continue to infinity perpendicular
+    // to the adjacent hull edges. Duplicate points get an empty cell.
+    struct VoronoiDiagram
+    {
+        NDArray<double, 2> vertices;             // T x 2 circumcenters
+        std::vector<size_type> cellOffsets{};    // N + 1
+        std::vector<size_type> cellVertices{};   // voronoi vertex indices
+        std::vector<std::uint8_t> unbounded{};   // 1 for hull points
+    };
+
+    // Bowyer-Watson insertion in Hilbert curve order with exact predicates
+    // Duplicate points are not part of any triangle, if all points are
+    // collinear there are no triangles and the hull holds the two extremes
+    DelaunayTriangulation delaunayTriangulation(
+        const NDArray<double, 2> &points,
+        const int count = -1);
+
+    template <Arithmetic T>
+    DelaunayTriangulation delaunayTriangulation(
+        const NDArray<T, 2> &points,
+        const int count = -1)
+    {
+        const auto N = (count < 0) ? points.shape()[0] : static_cast<size_type>(count);
+        assert(N <= points.shape()[0]);
+
+        auto converted = NDArray<double, 2>::Empty({N, 2});
+        for (size_type i = 0; i < N; ++i)
+        {
+            converted(i, 0) = static_cast<double>(points(i, 0));
+            converted(i, 1) = static_cast<double>(points(i, 1));
+        }
+
+        return delaunayTriangulation(converted);
+    }
+
+    VoronoiDiagram voronoiDiagram(
+        const NDArray<double, 2> &points,
+        const DelaunayTriangulation &triangulation);
+
+    template <Arithmetic T>
+    VoronoiDiagram voronoiDiagram(
+        const NDArray<T, 2> &points,
+        const DelaunayTriangulation &triangulation)
+    {
+        const auto N = points.shape()[0];
+        auto converted = NDArray<double, 2>::Empty({N, 2});
+        for (size_type i = 0; i < N; ++i)
+        {
+            converted(i, 0) = static_cast<double>(points(i, 0));
+            converted(i, 1) = static_cast<double>(points(i, 1));
+        }
+
+        return voronoiDiagram(converted, triangulation);
+    }
+
+    /**************************************************************************/
+
+    void testDelaunay();
+
+} // namespace Geometry
+
+#endif /* INCLUDE_CPP_EIGEN_OPENCV_SHARED_DELAUNAY_HPP */
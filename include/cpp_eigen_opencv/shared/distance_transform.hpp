@@ -0,0 +1,31 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Sparsh Jain
+ *
+ */
+
+#ifndef INCLUDE_CPP_EIGEN_OPENCV_SHARED_DISTANCE_TRANSFORM_HPP
+#define INCLUDE_CPP_EIGEN_OPENCV_SHARED_DISTANCE_TRANSFORM_HPP
+
+#include <cstdint>
+#include <cpp_eigen_opencv/shared/ndarray.hpp>
+#include <cpp_eigen_opencv/shared/geometry.hpp>
+
+namespace Geometry
+{
+    // Exact Euclidean distance from every pixel to the nearest zero pixel
+    // of a mask, like cv::distanceTransform with DIST_L2 and DIST_MASK_PRECISE
+    // Zero pixels get 0, every pixel gets +inf if the mask has no zero pixel.
+    // Meijster's column scan followed by the Felzenszwalb-Huttenlocher
+    // lower envelope of parabolas along rows, linear in the number of
+    // pixels. Column blocks and rows are spread over threads.
+    NDArray<float, 2> distanceTransform(const NDArray<std::uint8_t, 2> &mask);
+
+    /**************************************************************************/
+
+    void testDistanceTransform();
+
+} // namespace Geometry
+
+#endif /* INCLUDE_CPP_EIGEN_OPENCV_SHARED_DISTANCE_TRANSFORM_HPP */
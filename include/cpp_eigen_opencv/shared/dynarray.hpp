@@ -0,0 +1,250 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Sparsh Jain
+ *
+ */
+
+#ifndef INCLUDE_CPP_EIGEN_OPENCV_SHARED_DYNARRAY_HPP
+#define INCLUDE_CPP_EIGEN_OPENCV_SHARED_DYNARRAY_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cpp_eigen_opencv/shared/ndarray.hpp>
+
+// Arrays whose element type and rank are only known at run time, e.g.
+// read from a file. A DynArray is the same kind of buffer as an NDArray
+// plus a dtype tag and a runtime shape. Converting between the two never
+// copies, and every operation switches on the dtype once and then runs
+// the typed NDArray code, kernels included, over the whole buffer.
+
+namespace ND
+{
+    enum class DType : std::uint8_t
+    {
+        UInt8,
+        Int16,
+        UInt16,
+        Int32,
+        Int64,
+        Float32,
+        Float64,
+    };
+
+    template <typename T>
+    inline constexpr bool HasDType = std::is_same_v<T, std::uint8_t> || std::is_same_v<T, std::int16_t> ||
+                                     std::is_same_v<T, std::uint16_t> || std::is_same_v<T, std::int32_t> ||
+                                     std::is_same_v<T, std::int64_t> || std::is_same_v<T, float> ||
+                                     std::is_same_v<T, double>;
+
+    // The dtype tag of an element type
+    template <typename T>
+        requires HasDType<std::remove_cv_t<T>>
+    inline constexpr DType dtypeOf = []()
+    {
+        using U = std::remove_cv_t<T>;
+        if constexpr (std::is_same_v<U, std::uint8_t>)
+            return DType::UInt8;
+        else if constexpr (std::is_same_v<U, std::int16_t>)
+            return DType::Int16;
+        else if constexpr (std::is_same_v<U, std::uint16_t>)
+            return DType::UInt16;
+        else if constexpr (std::is_same_v<U, std::int32_t>)
+            return DType::Int32;
+        else if constexpr (std::is_same_v<U, std::int64_t>)
+            return DType::Int64;
+        else if constexpr (std::is_same_v<U, float>)
+            return DType::Float32;
+        else
+            return DType::Float64;
+    }();
+
+    size_type dtypeSize(DType dtype);
+
+    // NumPy style names, e.g. "uint8" or "float64"
+    const char *dtypeName(DType dtype);
+
+    // Calls f(std::type_identity<T>{}) with T the element type of dtype
+    // This is the one switch per operation, f is instantiated per type.
+    template <typename F>
+    decltype(auto) visitDType(DType dtype, F &&f)
+    {
+        switch (dtype)
+        {
+        case DType::UInt8:
+            return f(std::type_identity<std::uint8_t>{});
+        case DType::Int16:
+            return f(std::type_identity<std::int16_t>{});
+        case DType::UInt16:
+            return f(std::type_identity<std::uint16_t>{});
+        case DType::Int32:
+            return f(std::type_identity<std::int32_t>{});
+        case DType::Int64:
+            return f(std::type_identity<std::int64_t>{});
+        case DType::Float32:
+            return f(std::type_identity<float>{});
+        case DType::Float64:
+            break;
+        }
+        return f(std::type_identity<double>{});
+    }
+
+    // Type-erased N-dimensional array
+    // Same storage rules as NDArray: row-major, contiguous, copies share
+    // the buffer and Copy() makes a deep copy.
+    class DynArray final
+    {
+    private:
+        std::shared_ptr<void> m_owned_data{nullptr};
+        std::byte *m_data{nullptr};
+        DType m_dtype{DType::Float64};
+
+        std::vector<size_type> m_shape{};
+        std::vector<size_type> m_strides{}; // in elements, like NDArray
+        size_type m_size{0};
+
+        template <size_type NDim>
+        static std::vector<size_type> toVector(const Shape<NDim> &shape)
+        {
+            return std::vector<size_type>(shape.begin(), shape.end());
+        }
+
+        template <typename T, size_type NDim>
+        static DynArray fromContiguous(const NDArray<T, NDim> &array)
+        {
+            return DynArray(const_cast<T *>(array.data()), dtypeOf<T>, toVector(array.shape()), array.m_owned_data);
+        }
+
+        template <typename T>
+        inline T *typed() const
+        {
+            assert(dtypeOf<T> == m_dtype && "DType mismatch");
+            return reinterpret_cast<T *>(m_data);
+        }
+
+    public:
+        // Empty float64 array of shape {0}
+        DynArray();
+
+        // Non-owning view of data, e.g. a file mapped into memory. owner,
+        // if given, keeps data alive for as long as any copy exists.
+        DynArray(void *data, DType dtype, std::vector<size_type> shape, std::shared_ptr<void> owner = nullptr);
+
+        // Shares the buffer of array, strided views are copied first
+        template <typename T, size_type NDim>
+            requires HasDType<T>
+        explicit DynArray(const NDArray<T, NDim> &array)
+            : DynArray(fromContiguous(array.Contiguous()))
+        {
+        }
+
+        ~DynArray() = default;
+        DynArray(const DynArray &other) = default;
+        DynArray &operator=(const DynArray &other) = default;
+        DynArray(DynArray &&other) noexcept = default;
+        DynArray &operator=(DynArray &&other) noexcept = default;
+
+        // Factory Functions to create owning DynArray
+        static DynArray Empty(DType dtype, std::vector<size_type> shape);
+        static DynArray Zeros(DType dtype, std::vector<size_type> shape);
+
+        // Queries
+        inline DType dtype() const { return m_dtype; }
+        inline size_type ndim() const { return m_shape.size(); }
+        inline size_type size() const { return m_size; }
+        inline size_type nbytes() const { return m_size * dtypeSize(m_dtype); }
+        inline const std::vector<size_type> &shape() const { return m_shape; }
+        inline const std::vector<size_type> &strides() const { return m_strides; }
+
+        // Access
+        inline void *data() { return m_data; }
+        inline const void *data() const { return m_data; }
+
+        template <typename T>
+        inline T *data() { return typed<T>(); }
+
+        template <typename T>
+        inline const T *data() const { return typed<T>(); }
+
+        // Typed view sharing the buffer, asserts that T and NDim match
+        template <typename T, size_type NDim>
+            requires HasDType<T>
+        NDArray<T, NDim> as() const
+        {
+            assert(ndim() == NDim && "Rank mismatch");
+
+            Shape<NDim> shape{};
+            std::copy(m_shape.begin(), m_shape.end(), shape.begin());
+            if (!m_owned_data)
+                return NDArray<T, NDim>(typed<T>(), shape);
+
+            return NDArray<T, NDim>(std::shared_ptr<T[]>(m_owned_data, typed<T>()), shape);
+        }
+
+        // All elements as one flat typed view
+        template <typename T>
+            requires HasDType<T>
+        NDArray<T, 1> flat() const
+        {
+            if (m_size == 0)
+                return NDArray<T, 1>::Empty({0});
+
+            return DynArray(m_data, m_dtype, {m_size}, m_owned_data).as<T, 1>();
+        }
+
+        // Same buffer with another shape of the same size
+        DynArray reshape(std::vector<size_type> shape) const;
+
+        // Element i in row-major order converted to double
+        double at(size_type i) const;
+
+        // Copying
+        DynArray Copy() const;
+
+        // Conversion to another dtype, see NDArray::AsType
+        DynArray AsType(DType dtype, double scale = 1.0, double offset = 0.0, Rounding rounding = Rounding::Nearest) const;
+    };
+
+    // Element-wise arithmetic on arrays of one dtype and shape, or with a
+    // double scalar. The result has the dtype the typed NDArray operator
+    // produces, so integers narrower than int widen to int32 and a double
+    // scalar gives float64.
+    DynArray operator+(const DynArray &a, const DynArray &b);
+    DynArray operator-(const DynArray &a, const DynArray &b);
+    DynArray operator*(const DynArray &a, const DynArray &b);
+    DynArray operator/(const DynArray &a, const DynArray &b);
+    DynArray operator+(const DynArray &a, double b);
+    DynArray operator-(const DynArray &a, double b);
+    DynArray operator*(const DynArray &a, double b);
+    DynArray operator/(const DynArray &a, double b);
+
+    // Sum of products of two flat arrays of one dtype, in double
+    double dot(const DynArray &a, const DynArray &b);
+
+    // NumPy .npy files, little-endian and C order, in any dtype above
+    // The buffer is read in place, without per element conversion.
+    std::optional<DynArray> readNpy(std::istream &in);
+    bool writeNpy(std::ostream &out, const DynArray &array);
+
+    namespace Detail
+    {
+        // Bytes left in a seekable stream, the maximum if that is unknown.
+        // Readers check a header's size against it before allocating.
+        size_type remainingBytes(std::istream &in);
+    }
+
+    /**************************************************************************/
+
+    void testDynArray();
+
+} // namespace ND
+
+#endif /* INCLUDE_CPP_EIGEN_OPENCV_SHARED_DYNARRAY_HPP */
@@ -10,15 +10,18 @@
 
 #include <type_traits>
 #include <numbers>
+#include <algorithm>
 #include <array>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <utility>
 #include <vector>
 #include <cmath>
 #include <cpp_eigen_opencv/shared/ndarray.hpp>
 #include <cpp_eigen_opencv/shared/debug.hpp>
-
-#ifdef DEBUG
-#include <iostream>
-#endif // DEBUG
+#include <cpp_eigen_opencv/shared/kernels.hpp>
+#include <cpp_eigen_opencv/shared/trace.hpp>
 
 namespace Geometry
 {
@@ -41,6 +44,87 @@ namespace Geometry
         Descending
     };
 
+    // Integer coordinates narrow enough for exact orientation tests
+    template <typename T>
+    concept PixelIntegral = Integral<T> && !std::same_as<T, bool> && sizeof(T) <= 4;
+
+    namespace Detail
+    {
+        __extension__ using Int128 = __int128;
+
+        // Signed type holding 2D cross products of coordinate differences
+        // exactly, int64 for up to 16-bit coordinates and 128 bits beyond
+        template <PixelIntegral T>
+        using WideProduct = std::conditional_t<sizeof(T) <= 2, std::int64_t, Int128>;
+
+        // Twice the signed area of the triangle a, b, c, positive if
+        // counter-clockwise. Exact for pixel integer types.
+        template <Arithmetic T>
+        inline auto orientation(T ax, T ay, T bx, T by, T cx, T cy)
+        {
+            const auto compute = [&]<typename U>()
+            {
+                return (static_cast<U>(bx) - static_cast<U>(ax)) * (static_cast<U>(cy) - static_cast<U>(ay)) -
+                       (static_cast<U>(by) - static_cast<U>(ay)) * (static_cast<U>(cx) - static_cast<U>(ax));
+            };
+
+            if constexpr (PixelIntegral<T>)
+                return compute.template operator()<WideProduct<T>>();
+            else
+                return compute.template operator()<std::common_type_t<T, double>>();
+        }
+
+        // Same for rows a, b, c of a point array
+        template <Arithmetic T>
+        inline auto orientation(
+            const NDArray<T, 2> &points,
+            size_type a,
+            size_type b,
+            size_type c)
+        {
+            return orientation(points(a, 0), points(a, 1),
+                               points(b, 0), points(b, 1),
+                               points(c, 0), points(c, 1));
+        }
+
+        // Result type of orientation for coordinates of type T, signed
+        template <Arithmetic T>
+        using Orientation = decltype(orientation(T{}, T{}, T{}, T{}, T{}, T{}));
+
+        // True if (x, y) lies inside or on a counter-clockwise convex
+        // polygon with at least three vertices, O(log n) by a binary
+        // search over the fan of triangles at vertex 0
+        // Points up to tolerance outside an edge count as inside, measured
+        // as the orientation value, i.e. twice the triangle area.
+        template <Arithmetic T>
+        bool insideConvex(const NDArray<T, 2> &hull, const T x, const T y,
+                          const Orientation<T> tolerance = Orientation<T>{0})
+        {
+            const auto n = hull.shape()[0];
+            assert(n >= 3 && "insideConvex expects a polygon");
+
+            const auto side = [&](size_type a, size_type b)
+            { return orientation(hull(a, 0), hull(a, 1), hull(b, 0), hull(b, 1), x, y); };
+
+            if (side(0, 1) < -tolerance || side(0, n - 1) > tolerance)
+                return false;
+
+            size_type lo = 1, hi = n - 1;
+            while (hi - lo > 1)
+            {
+                const auto mid = lo + (hi - lo) / 2;
+                if (side(0, mid) >= 0)
+                    lo = mid;
+                else
+                    hi = mid;
+            }
+
+            return side(lo, lo + 1) >= -tolerance;
+        }
+    }
+
+    // Integer inputs are multiplied in a wide integer type and only the
+    // exact result is converted to U
     template <Arithmetic T, Arithmetic U = double>
     inline constexpr U cross(
         const NDArray<T, 1> &a,
@@ -52,26 +136,114 @@ namespace Geometry
         assert(b.size() == static_cast<size_type>(2) &&
                "cross product defined for 2D vectors only");
 
-        DEBUG_ONLY static bool nonFloatWarningShown = false;
-        if constexpr (!std::is_floating_point_v<T>)
+        if constexpr (PixelIntegral<T>)
+        {
+            using W = Detail::WideProduct<T>;
+            return static_cast<U>(static_cast<W>(a[0]) * static_cast<W>(b[1]) -
+                                  static_cast<W>(a[1]) * static_cast<W>(b[0]));
+        }
+        else
         {
-#ifdef DEBUG
-            if (!nonFloatWarningShown)
+            auto ax = static_cast<U>(a[0]);
+            auto ay = static_cast<U>(a[1]);
+            auto bx = static_cast<U>(b[0]);
+            auto by = static_cast<U>(b[1]);
+            return ax * by - ay * bx;
+        }
+    }
+
+    namespace Detail
+    {
+        // Unsigned bits of a pixel coordinate with the same ordering
+        template <PixelIntegral T>
+        inline constexpr auto orderedBits(T value)
+        {
+            using Bits = std::conditional_t<sizeof(T) <= 2, std::uint16_t, std::uint32_t>;
+
+            const auto bits = static_cast<Bits>(static_cast<std::make_unsigned_t<T>>(value));
+            if constexpr (std::is_signed_v<T>)
+                return static_cast<Bits>(bits ^ (Bits{1} << (8 * sizeof(T) - 1)));
+            else
+                return bits;
+        }
+
+        // Argsort of pixel points through packed keys, x in the high half
+        // and y in the low half, so comparing keys compares points.
+        // 16-bit points get 32-bit keys and a stable radix sort, the key
+        // loop runs on 16-bit lanes for contiguous rows.
+        template <PixelIntegral T>
+        std::vector<size_type> argSortPointsPacked(
+            const NDArray<T, 2> &points,
+            const Order order,
+            const size_type N)
+        {
+            using Key = std::conditional_t<sizeof(T) <= 2, std::uint32_t, std::uint64_t>;
+            constexpr auto halfBits = 4 * sizeof(Key);
+
+            const Key flip = (order == Descending) ? ~Key{0} : Key{0};
+            const auto makeKey = [flip](T x, T y)
+            {
+                return static_cast<Key>(((static_cast<Key>(orderedBits(x)) << halfBits) |
+                                         static_cast<Key>(orderedBits(y))) ^
+                                        flip);
+            };
+
+            std::vector<Key> keys(N);
+            // Interleaved rows load as plain 16-bit lanes
+            const T *data = points.data();
+            if (N < 2 || (&points(0, 1) == data + 1 && &points(1, 0) == data + 2))
+            {
+                for (size_type i = 0; i < N; ++i)
+                    keys[i] = makeKey(data[2 * i], data[2 * i + 1]);
+            }
+            else
             {
+                for (size_type i = 0; i < N; ++i)
+                    keys[i] = makeKey(points(i, 0), points(i, 1));
+            }
+
+            std::vector<size_type> indices(N);
+            std::iota(indices.begin(), indices.end(), 0);
 
-                std::cerr << "Warning: cross product called with non floating-point types. "
-                          << "Results may be inaccurate due to ."
-                          << std::endl;
-                nonFloatWarningShown = true;
+            if constexpr (sizeof(Key) == 4)
+            {
+                // LSD radix sort on bytes, skipping bytes shared by all keys
+                std::vector<Key> keysOut(N);
+                std::vector<size_type> indicesOut(N);
+                for (unsigned shift = 0; shift < 32; shift += 8)
+                {
+                    std::array<size_type, 257> offsets{};
+                    for (const auto key : keys)
+                        ++offsets[((key >> shift) & 0xFF) + 1];
+
+                    if (N == 0 || offsets[((keys[0] >> shift) & 0xFF) + 1] == N)
+                        continue;
+
+                    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+                    for (size_type i = 0; i < N; ++i)
+                    {
+                        const auto position = offsets[(keys[i] >> shift) & 0xFF]++;
+                        keysOut[position] = keys[i];
+                        indicesOut[position] = indices[i];
+                    }
+
+                    keys.swap(keysOut);
+                    indices.swap(indicesOut);
+                }
             }
-#endif // DEBUG
-        }
+            else
+            {
+                std::vector<std::pair<Key, size_type>> pairs(N);
+                for (size_type i = 0; i < N; ++i)
+                    pairs[i] = {keys[i], i};
 
-        auto ax = static_cast<U>(a[0]);
-        auto ay = static_cast<U>(a[1]);
-        auto bx = static_cast<U>(b[0]);
-        auto by = static_cast<U>(b[1]);
-        return ax * by - ay * bx;
+                std::sort(pairs.begin(), pairs.end());
+                for (size_type i = 0; i < N; ++i)
+                    indices[i] = pairs[i].second;
+            }
+
+            return indices;
+        }
     }
 
     // Argsort the first count points, all if count < 0
@@ -81,9 +253,13 @@ namespace Geometry
         const Order order = Ascending,
         const int count = -1)
     {
+        TRACE_SCOPE("geometry.argSortPoints");
         const auto N = (count < 0) ? static_cast<int>(points.shape()[0]) : count;
         assert(N <= static_cast<int>(points.shape()[0]));
 
+        if constexpr (PixelIntegral<T>)
+            return Detail::argSortPointsPacked(points, order, static_cast<size_type>(N));
+
         auto indices = std::vector<size_type>(static_cast<std::size_t>(N));
         std::iota(indices.begin(), indices.end(), 0);
 
@@ -120,6 +296,7 @@ namespace Geometry
         const NDArray<T, 2> &points,
         const int count = -1)
     {
+        TRACE_SCOPE("geometry.computeConvexHull");
         const auto N = (count < 0) ? static_cast<int>(points.shape()[0]) : count;
         assert(N <= static_cast<int>(points.shape()[0]));
 
@@ -137,48 +314,52 @@ namespace Geometry
 
         const auto sortedIdx = argSortPoints(points, Ascending, count);
 
-        // Store the hull points in a vector
-        std::vector<NDArray<const T, 1>> hull;
+        // Monotone chain over row indices, the orientation test reads the
+        // rows in place and is exact for pixel integer types
+        // The loop has no clones in kernels.cpp: every test depends on the
+        // stack the previous one left, so wider vectors do not help, and an
+        // out-of-line call per point would cost more than its few multiplies.
+        std::vector<size_type> hull;
+        hull.reserve(static_cast<std::size_t>(N) + 1);
+        const auto turnsRight = [&points, &hull](size_type idx)
+        { return Detail::orientation(points, hull[hull.size() - 2], hull.back(), idx) <= 0; };
+
         for (const auto &idx : sortedIdx)
         {
-            // Extract the point as a 1D NDArray of size 2
-            const auto p = NDArray<const T, 1>(&points(idx, 0), {2});
-
-            while ((hull.size() >= 2) &&
-                   (cross(hull[hull.size() - 1] - hull[hull.size() - 2],
-                          p - hull[hull.size() - 2]) <= 0))
+            while ((hull.size() >= 2) && turnsRight(idx))
             {
                 hull.pop_back();
             }
-            hull.push_back(p);
+            hull.push_back(idx);
         }
 
         const auto lowerSize = hull.size();
         for (int i = N - 2; i >= 0; --i)
         {
             const auto idx = sortedIdx[static_cast<std::size_t>(i)];
-            const auto p = NDArray<const T, 1>(&points(idx, 0), {2});
-            while ((hull.size() > lowerSize) &&
-                   (cross(hull[hull.size() - 1] - hull[hull.size() - 2],
-                          p - hull[hull.size() - 2]) <= 0))
+            while ((hull.size() > lowerSize) && turnsRight(idx))
             {
                 hull.pop_back();
             }
-            hull.push_back(p);
+            hull.push_back(idx);
         }
 
         // Remove repeated point
         hull.pop_back();
 
-        // Convert hull points to NDArray
-        auto hullPoints = NDArray<T, 2>::Empty({hull.size(), 2});
-        for (size_type i = 0; i < hull.size(); ++i)
+        // take would copy all N rows of a strided view to read h of them
+        if (!points.IsContiguous()) [[unlikely]]
         {
-            hullPoints(i, 0) = hull[i][0];
-            hullPoints(i, 1) = hull[i][1];
+            auto result = NDArray<T, 2>::Empty({hull.size(), 2});
+            for (size_type k = 0; k < hull.size(); ++k)
+            {
+                result(k, 0) = points(hull[k], 0);
+                result(k, 1) = points(hull[k], 1);
+            }
+            return result;
         }
 
-        return hullPoints;
+        return take(points, hull);
     }
 
     // Struct to store a rotated rectangle
@@ -201,12 +382,137 @@ namespace Geometry
         }
     };
 
+    namespace Detail
+    {
+        // Zero-size rectangle on the first hull vertex, for hulls whose
+        // vertices all coincide
+        template <Arithmetic T>
+        RotatedRectangle pointRectangle(const NDArray<T, 2> &hull)
+        {
+            RotatedRectangle res{};
+            res.center[0] = static_cast<double>(hull(0, 0));
+            res.center[1] = static_cast<double>(hull(0, 1));
+            return res;
+        }
+
+        // Rotating calipers over a counter-clockwise pixel hull with at
+        // least two vertices. Edge directions stay unnormalized, so the
+        // projections that move the calipers are exact integers, and area
+        // comparisons are exact for 16-bit coordinates. Floating point is
+        // only used for the final rectangle.
+        template <PixelIntegral T>
+        RotatedRectangle minAreaRectangleExact(const NDArray<T, 2> &hull)
+        {
+            TRACE_SCOPE("geometry.minAreaRectangleExact");
+            using W = WideProduct<T>;
+
+            const auto n = hull.shape()[0];
+            assert(n >= 2 && "minAreaRectangleExact expects at least two hull vertices");
+
+            // Caliper positions only move forward, vertex k % n
+            const auto x = [&hull, n](size_type k)
+            { return static_cast<W>(hull(k % n, 0)); };
+            const auto y = [&hull, n](size_type k)
+            { return static_cast<W>(hull(k % n, 1)); };
+
+            size_type right = 0;
+            size_type top = 0;
+            size_type left = 0;
+
+            W bestWidth = 0, bestHeight = 0, bestLength2 = 0;
+            size_type bestEdge = 0, bestLeft = 0, bestRight = 0;
+
+            for (size_type i = 0; i < n; ++i)
+            {
+                const W ex = x(i + 1) - x(i);
+                const W ey = y(i + 1) - y(i);
+                const auto along = [&](size_type k)
+                { return ex * x(k) + ey * y(k); };
+                const auto away = [&](size_type k)
+                { return ex * (y(k) - y(i)) - ey * (x(k) - x(i)); };
+
+                right = std::max(right, i + 1);
+                while (along(right + 1) > along(right))
+                    ++right;
+                top = std::max(top, right);
+                while (away(top + 1) > away(top))
+                    ++top;
+                left = std::max(left, top);
+                while (along(left + 1) < along(left))
+                    ++left;
+
+                const W width = along(right) - along(left);
+                const W height = away(top);
+                const W length2 = ex * ex + ey * ey;
+                if (length2 == 0)
+                    continue;
+
+                // width * height / length2 < bestWidth * bestHeight / bestLength2
+                bool smaller = (bestLength2 == 0);
+                if (!smaller)
+                {
+                    if constexpr (sizeof(T) <= 2)
+                    {
+                        smaller = static_cast<Int128>(width) * height * bestLength2 <
+                                  static_cast<Int128>(bestWidth) * bestHeight * length2;
+                    }
+                    else
+                    {
+                        using F = long double;
+                        smaller = static_cast<F>(width) * static_cast<F>(height) / static_cast<F>(length2) <
+                                  static_cast<F>(bestWidth) * static_cast<F>(bestHeight) / static_cast<F>(bestLength2);
+                    }
+                }
+
+                if (smaller)
+                {
+                    bestWidth = width;
+                    bestHeight = height;
+                    bestLength2 = length2;
+                    bestEdge = i;
+                    bestLeft = left;
+                    bestRight = right;
+                }
+            }
+
+            // Every vertex coincides, there is no edge to align with
+            if (bestLength2 == 0)
+                return pointRectangle(hull);
+
+            const auto i = bestEdge;
+            const W ex = x(i + 1) - x(i);
+            const W ey = y(i + 1) - y(i);
+            const double length = std::sqrt(static_cast<double>(bestLength2));
+            const double ux = static_cast<double>(ex) / length;
+            const double uy = static_cast<double>(ey) / length;
+
+            // Rectangle extents in the frame of the edge
+            const double minX = static_cast<double>(ex * x(bestLeft) + ey * y(bestLeft)) / length;
+            const double maxX = static_cast<double>(ex * x(bestRight) + ey * y(bestRight)) / length;
+            const double minY = static_cast<double>(ex * y(i) - ey * x(i)) / length;
+            const double maxY = minY + static_cast<double>(bestHeight) / length;
+
+            const double centerLocalX = (minX + maxX) * 0.5;
+            const double centerLocalY = (minY + maxY) * 0.5;
+
+            RotatedRectangle rectangle{};
+            rectangle.center[0] = ux * centerLocalX - uy * centerLocalY;
+            rectangle.center[1] = uy * centerLocalX + ux * centerLocalY;
+            rectangle.size[0] = static_cast<double>(bestWidth) / length;
+            rectangle.size[1] = static_cast<double>(bestHeight) / length;
+            rectangle.angle = std::atan2(uy, ux);
+            return rectangle;
+        }
+    }
+
     // Function to compute min area rectangle containing a set of points
+    // Pixel integer hulls take the exact rotating calipers path
     template <Arithmetic T>
     RotatedRectangle minAreaRectangle(
         const NDArray<T, 2> &points,
         const int count = -1)
     {
+        TRACE_SCOPE("geometry.minAreaRectangle");
         const auto N = (count < 0) ? static_cast<int>(points.shape()[0]) : count;
         assert(N <= static_cast<int>(points.shape()[0]));
 
@@ -219,12 +525,12 @@ namespace Geometry
 
         if (n == 1)
         {
-            RotatedRectangle res{};
-            res.center[0] = hull(0, 0);
-            res.center[1] = hull(0, 1);
-            return res;
+            return Detail::pointRectangle(hull);
         }
 
+        if constexpr (PixelIntegral<T>)
+            return Detail::minAreaRectangleExact(hull);
+
         auto minArea = std::numeric_limits<double>::infinity();
         RotatedRectangle bestRectangle{};
 
@@ -246,15 +552,28 @@ namespace Geometry
             double minY = minX;
             double maxY = maxX;
 
-            for (size_type j = 0; j < n; ++j)
+            // The O(h^2) part, float and double hulls use the cloned kernel
+            if constexpr (std::same_as<T, float> || std::same_as<T, double>)
+            {
+                double bounds[4];
+                Kernels::projectionBounds(hull.data(), n, ux[0], ux[1], bounds);
+                minX = bounds[0];
+                maxX = bounds[1];
+                minY = bounds[2];
+                maxY = bounds[3];
+            }
+            else
             {
-                const auto p = NDArray<const T, 1>(&hull(j, 0), {2});
-                double projX = static_cast<double>(ND::dot(p, ux));
-                double projY = static_cast<double>(ND::dot(p, uy));
-                minX = std::min(minX, projX);
-                maxX = std::max(maxX, projX);
-                minY = std::min(minY, projY);
-                maxY = std::max(maxY, projY);
+                for (size_type j = 0; j < n; ++j)
+                {
+                    const auto p = NDArray<const T, 1>(&hull(j, 0), {2});
+                    double projX = static_cast<double>(ND::dot(p, ux));
+                    double projY = static_cast<double>(ND::dot(p, uy));
+                    minX = std::min(minX, projX);
+                    maxX = std::max(maxX, projX);
+                    minY = std::min(minY, projY);
+                    maxY = std::max(maxY, projY);
+                }
             }
 
             const double width = maxX - minX;
@@ -272,6 +591,10 @@ namespace Geometry
             }
         }
 
+        // Every edge had zero length, the hull is one repeated point
+        if (minArea == std::numeric_limits<double>::infinity())
+            return Detail::pointRectangle(hull);
+
         return bestRectangle;
     }
 
@@ -282,6 +605,7 @@ namespace Geometry
 
     void testConvexHull();
     void testMinAreaRectangle();
+    void testIntegerGeometry();
 
 } // namespace Geometry
 
@@ -0,0 +1,416 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Sparsh Jain
+ *
+ */
+
+#ifndef INCLUDE_CPP_EIGEN_OPENCV_SHARED_KDTREE_HPP
+#define INCLUDE_CPP_EIGEN_OPENCV_SHARED_KDTREE_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <thread>
+#include <vector>
+#include <cpp_eigen_opencv/shared/ndarray.hpp>
+#include <cpp_eigen_opencv/shared/geometry.hpp>
+#include <cpp_eigen_opencv/shared/parallel.hpp>
+
+namespace Geometry
+{
+    // Implicit KD-tree over the rows of an N x D NDArray
+    // The tree has no node objects: the points are stored permuted so that
+    // every subtree is a contiguous range [lo, hi) whose splitting point
+    // sits at mid = lo + (hi - lo) / 2, with smaller coordinates on the left.
+    // Ranges of at most leafSize points are scanned linearly.
+    template <Arithmetic T>
+    class KDTree final
+    {
+    public:
+        using value_type = T;
+
+        struct Neighbor
+        {
+            size_type index;        // row in the original point set
+            double distanceSquared; // squared euclidean distance to query
+        };
+
+        struct KnnResult
+        {
+            NDArray<size_type, 2> indices;          // Q x k
+            NDArray<double, 2> distancesSquared; // Q x k
+        };
+
+    private:
+        NDArray<T, 2> m_points;               // points in tree order
+        std::vector<size_type> m_indices{};   // tree slot -> original row
+        std::vector<std::uint8_t> m_splitDim{}; // split dimension at mid
+        size_type m_leafSize{8};
+
+        inline double distanceSquared(const auto &query, size_type slot) const
+        {
+            double d2{0};
+            for (size_type d = 0; d < dim(); ++d)
+            {
+                const double diff = static_cast<double>(query[d]) -
+                                    static_cast<double>(m_points(slot, d));
+                d2 += diff * diff;
+            }
+            return d2;
+        }
+
+        // Choose the dimension with the largest spread in [lo, hi)
+        // and partition idx around the median along it
+        void buildRange(
+            const NDArray<T, 2> &points,
+            std::vector<size_type> &idx,
+            size_type lo,
+            size_type hi,
+            size_type parallelDepth)
+        {
+            if (hi - lo <= m_leafSize)
+                return;
+
+            const auto D = dim();
+            std::uint8_t bestDim = 0;
+            double bestSpread = -1.0;
+            for (size_type d = 0; d < D; ++d)
+            {
+                const auto [minIt, maxIt] = std::minmax_element(
+                    idx.begin() + static_cast<std::ptrdiff_t>(lo),
+                    idx.begin() + static_cast<std::ptrdiff_t>(hi),
+                    [&points, d](size_type a, size_type b)
+                    { return points(a, d) < points(b, d); });
+
+                const double spread = static_cast<double>(points(*maxIt, d)) -
+                                      static_cast<double>(points(*minIt, d));
+                if (spread > bestSpread)
+                {
+                    bestSpread = spread;
+                    bestDim = static_cast<std::uint8_t>(d);
+                }
+            }
+
+            const auto mid = lo + (hi - lo) / 2;
+            std::nth_element(
+                idx.begin() + static_cast<std::ptrdiff_t>(lo),
+                idx.begin() + static_cast<std::ptrdiff_t>(mid),
+                idx.begin() + static_cast<std::ptrdiff_t>(hi),
+                [&points, bestDim](size_type a, size_type b)
+                { return points(a, bestDim) < points(b, bestDim); });
+            m_splitDim[mid] = bestDim;
+
+            // Subtrees are disjoint ranges, build the top levels concurrently
+            if (parallelDepth > 0)
+            {
+                std::jthread left([&, lo, mid]()
+                                  { buildRange(points, idx, lo, mid, parallelDepth - 1); });
+                buildRange(points, idx, mid + 1, hi, parallelDepth - 1);
+            }
+            else
+            {
+                buildRange(points, idx, lo, mid, 0);
+                buildRange(points, idx, mid + 1, hi, 0);
+            }
+        }
+
+        void knnRange(
+            const auto &query,
+            size_type k,
+            size_type lo,
+            size_type hi,
+            std::vector<Neighbor> &heap) const
+        {
+            const auto consider = [&](size_type slot)
+            {
+                const auto d2 = distanceSquared(query, slot);
+                if (heap.size() < k)
+                {
+                    heap.push_back({slot, d2});
+                    std::push_heap(heap.begin(), heap.end(), closer);
+                }
+                else if (d2 < heap.front().distanceSquared)
+                {
+                    std::pop_heap(heap.begin(), heap.end(), closer);
+                    heap.back() = {slot, d2};
+                    std::push_heap(heap.begin(), heap.end(), closer);
+                }
+            };
+
+            if (hi - lo <= m_leafSize)
+            {
+                for (size_type slot = lo; slot < hi; ++slot)
+                    consider(slot);
+                return;
+            }
+
+            const auto mid = lo + (hi - lo) / 2;
+            const auto d = m_splitDim[mid];
+            consider(mid);
+
+            const double diff = static_cast<double>(query[d]) -
+                                static_cast<double>(m_points(mid, d));
+            if (diff < 0)
+            {
+                knnRange(query, k, lo, mid, heap);
+                if (heap.size() < k || diff * diff < heap.front().distanceSquared)
+                    knnRange(query, k, mid + 1, hi, heap);
+            }
+            else
+            {
+                knnRange(query, k, mid + 1, hi, heap);
+                if (heap.size() < k || diff * diff < heap.front().distanceSquared)
+                    knnRange(query, k, lo, mid, heap);
+            }
+        }
+
+        void radiusRange(
+            const auto &query,
+            double radiusSquared,
+            size_type lo,
+            size_type hi,
+            std::vector<size_type> &out) const
+        {
+            if (hi - lo <= m_leafSize)
+            {
+                for (size_type slot = lo; slot < hi; ++slot)
+                {
+                    if (distanceSquared(query, slot) <= radiusSquared)
+                        out.push_back(m_indices[slot]);
+                }
+                return;
+            }
+
+            const auto mid = lo + (hi - lo) / 2;
+            const auto d = m_splitDim[mid];
+            if (distanceSquared(query, mid) <= radiusSquared)
+                out.push_back(m_indices[mid]);
+
+            const double diff = static_cast<double>(query[d]) -
+                                static_cast<double>(m_points(mid, d));
+            if (diff <= 0 || diff * diff <= radiusSquared)
+                radiusRange(query, radiusSquared, lo, mid, out);
+            if (diff >= 0 || diff * diff <= radiusSquared)
+                radiusRange(query, radiusSquared, mid + 1, hi, out);
+        }
+
+        void boxRange(
+            const auto &lower,
+            const auto &upper,
+            size_type lo,
+            size_type hi,
+            std::vector<size_type> &out) const
+        {
+            const auto inside = [&](size_type slot)
+            {
+                for (size_type d = 0; d < dim(); ++d)
+                {
+                    const double v = static_cast<double>(m_points(slot, d));
+                    if (v < static_cast<double>(lower[d]) ||
+                        v > static_cast<double>(upper[d]))
+                        return false;
+                }
+                return true;
+            };
+
+            if (hi - lo <= m_leafSize)
+            {
+                for (size_type slot = lo; slot < hi; ++slot)
+                {
+                    if (inside(slot))
+                        out.push_back(m_indices[slot]);
+                }
+                return;
+            }
+
+            const auto mid = lo + (hi - lo) / 2;
+            const auto d = m_splitDim[mid];
+            if (inside(mid))
+                out.push_back(m_indices[mid]);
+
+            const double split = static_cast<double>(m_points(mid, d));
+            if (static_cast<double>(lower[d]) <= split)
+                boxRange(lower, upper, lo, mid, out);
+            if (static_cast<double>(upper[d]) >= split)
+                boxRange(lower, upper, mid + 1, hi, out);
+        }
+
+        static inline bool closer(const Neighbor &a, const Neighbor &b)
+        {
+            return a.distanceSquared < b.distanceSquared;
+        }
+
+    public:
+        // Builds the tree over the first count rows of points, all if count < 0
+        // The points are copied, the tree does not reference the input
+        explicit KDTree(
+            const NDArray<T, 2> &points,
+            const size_type leafSize = 8,
+            const int count = -1)
+            : m_points(NDArray<T, 2>::Empty(
+                  {(count < 0) ? points.shape()[0] : static_cast<size_type>(count),
+                   points.shape()[1]})),
+              m_indices(m_points.shape()[0]),
+              m_splitDim(m_points.shape()[0], 0),
+              m_leafSize(std::max<size_type>(leafSize, 1))
+        {
+            const auto N = m_points.shape()[0];
+            const auto D = m_points.shape()[1];
+            assert(N <= points.shape()[0]);
+            assert(D > 0 && D <= std::numeric_limits<std::uint8_t>::max() &&
+                   "Unsupported point dimension");
+
+            std::iota(m_indices.begin(), m_indices.end(), 0);
+
+            // One extra level of subtrees per doubling of threads
+            size_type parallelDepth = 0;
+            for (auto threads = Parallel::hardwareThreads(); threads > 1; threads /= 2)
+                ++parallelDepth;
+            if (N < 8192)
+                parallelDepth = 0;
+
+            buildRange(points, m_indices, 0, N, parallelDepth);
+
+            // Store points in tree order so queries walk contiguous memory
+            Parallel::parallelFor(0, N, [&](size_type slot)
+                                  {
+                                      for (size_type d = 0; d < D; ++d)
+                                          m_points(slot, d) = points(m_indices[slot], d); });
+        }
+
+        // Queries
+        inline size_type size() const { return m_points.shape()[0]; }
+
+        inline size_type dim() const { return m_points.shape()[1]; }
+
+        // The k nearest neighbors of query sorted by increasing distance
+        // Returns fewer than k neighbors if the tree has fewer points
+        template <VectorLike Q>
+        void knn(const Q &query, size_type k, std::vector<Neighbor> &out) const
+        {
+            assert(query.size() == dim() && "Query dimension mismatch");
+
+            out.clear();
+            k = std::min(k, size());
+            if (k == 0)
+                return;
+
+            knnRange(query, k, 0, size(), out);
+            std::sort_heap(out.begin(), out.end(), closer);
+            for (auto &n : out)
+                n.index = m_indices[n.index];
+        }
+
+        template <VectorLike Q>
+        std::vector<Neighbor> knn(const Q &query, size_type k) const
+        {
+            std::vector<Neighbor> out;
+            out.reserve(std::min(k, size()));
+            knn(query, k, out);
+            return out;
+        }
+
+        // Indices of all points within radius of query (inclusive), unordered
+        template <VectorLike Q>
+        void radiusSearch(const Q &query, double radius, std::vector<size_type> &out) const
+        {
+            assert(query.size() == dim() && "Query dimension mismatch");
+
+            out.clear();
+            if (size() > 0)
+                radiusRange(query, radius * radius, 0, size(), out);
+        }
+
+        template <VectorLike Q>
+        std::vector<size_type> radiusSearch(const Q &query, double radius) const
+        {
+            std::vector<size_type> out;
+            radiusSearch(query, radius, out);
+            return out;
+        }
+
+        // Indices of all points inside the axis aligned box [lower, upper], unordered
+        template <VectorLike Q>
+        std::vector<size_type> boxSearch(const Q &lower, const Q &upper) const
+        {
+            assert(lower.size() == dim() && upper.size() == dim() &&
+                   "Query dimension mismatch");
+
+            std::vector<size_type> out;
+            if (size() > 0)
+                boxRange(lower, upper, 0, size(), out);
+            return out;
+        }
+
+        // Batched queries, one query per row, run in parallel
+        // Rows of the knn result are padded with size() / infinity when
+        // the tree has fewer than k points
+        KnnResult knnBatch(const NDArray<T, 2> &queries, size_type k) const
+        {
+            assert(queries.shape()[1] == dim() && "Query dimension mismatch");
+
+            const auto Q = queries.shape()[0];
+            KnnResult result{NDArray<size_type, 2>::Full({Q, k}, size()),
+                             NDArray<double, 2>::Full({Q, k}, std::numeric_limits<double>::infinity())};
+
+            const auto chunks = Parallel::chunkCount(Q, 64);
+            Parallel::parallelForChunks(0, Q, chunks, [&](size_type lo, size_type hi, size_type)
+                                        {
+                                            std::vector<Neighbor> neighbors;
+                                            neighbors.reserve(std::min(k, size()));
+                                            for (size_type q = lo; q < hi; ++q)
+                                            {
+                                                knn(NDArray<const T, 1>(&queries(q, 0), {dim()}), k, neighbors);
+                                                for (size_type j = 0; j < neighbors.size(); ++j)
+                                                {
+                                                    result.indices(q, j) = neighbors[j].index;
+                                                    result.distancesSquared(q, j) = neighbors[j].distanceSquared;
+                                                }
+                                            } });
+
+            return result;
+        }
+
+        std::vector<std::vector<size_type>> radiusSearchBatch(
+            const NDArray<T, 2> &queries,
+            double radius) const
+        {
+            assert(queries.shape()[1] == dim() && "Query dimension mismatch");
+
+            const auto Q = queries.shape()[0];
+            std::vector<std::vector<size_type>> result(Q);
+            Parallel::parallelFor(0, Q, [&](size_type q)
+                                  { radiusSearch(NDArray<const T, 1>(&queries(q, 0), {dim()}), radius, result[q]); },
+                                  64);
+
+            return result;
+        }
+
+        // lowers and uppers hold one box corner per row
+        std::vector<std::vector<size_type>> boxSearchBatch(
+            const NDArray<T, 2> &lowers,
+            const NDArray<T, 2> &uppers) const
+        {
+            assert(lowers.shape() == uppers.shape() && "Shape Mismatch");
+            assert(lowers.shape()[1] == dim() && "Query dimension mismatch");
+
+            const auto Q = lowers.shape()[0];
+            std::vector<std::vector<size_type>> result(Q);
+            Parallel::parallelFor(0, Q, [&](size_type q)
+                                  { result[q] = boxSearch(NDArray<const T, 1>(&lowers(q, 0), {dim()}),
+                                                          NDArray<const T, 1>(&uppers(q, 0), {dim()})); },
+                                  64);
+
+            return result;
+        }
+    };
+
+    /**************************************************************************/
+
+    void testKDTree();
+
+} // namespace Geometry
+
+#endif /* INCLUDE_CPP_EIGEN_OPENCV_SHARED_KDTREE_HPP */
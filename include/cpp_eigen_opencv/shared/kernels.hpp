@@ -0,0 +1,193 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Sparsh Jain
+ *
+ */
+
+#ifndef INCLUDE_CPP_EIGEN_OPENCV_SHARED_KERNELS_HPP
+#define INCLUDE_CPP_EIGEN_OPENCV_SHARED_KERNELS_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+// Hot loops compiled once per x86-64 ISA level (v2, v3, v4 and the build
+// baseline) in kernels.cpp, the loader picks the best one for the host
+// through an ifunc resolver. A release built with make PORTABLE=1 runs on
+// any x86-64 host and still gets AVX2 or AVX-512 in these loops.
+// Other targets and -DND_NO_MULTIVERSION compile a single version.
+//
+// All kernels work on contiguous memory. The templates in ndarray.hpp,
+// geometry.hpp and moments.hpp call them for the types listed here and
+// keep their plain loops for everything else.
+
+namespace ND::Kernels
+{
+    using size_type = std::size_t;
+
+    // Element types with cloned kernels
+    template <typename T>
+    concept Element = std::same_as<std::remove_cv_t<T>, float> ||
+                      std::same_as<std::remove_cv_t<T>, double> ||
+                      std::same_as<std::remove_cv_t<T>, std::int32_t>;
+
+    // Both operands are the same kernel element type
+    template <typename T, typename U>
+    concept Dispatched = Element<T> && std::same_as<std::remove_cv_t<T>, std::remove_cv_t<U>>;
+
+    // Calls with fewer elements stay inline, the indirect call through the
+    // resolver costs more than it saves
+    inline constexpr size_type MinDotSize = 32;
+
+    // Element-wise out[i] = a[i] op b[i], a[i] op b or a op b[i]
+#define ND_DECLARE_ELEMENTWISE_KERNELS(T)                              \
+    void add(const T *a, const T *b, T *out, size_type n);             \
+    void subtract(const T *a, const T *b, T *out, size_type n);        \
+    void multiply(const T *a, const T *b, T *out, size_type n);        \
+    void divide(const T *a, const T *b, T *out, size_type n);          \
+    void add(const T *a, T b, T *out, size_type n);                    \
+    void subtract(const T *a, T b, T *out, size_type n);               \
+    void multiply(const T *a, T b, T *out, size_type n);               \
+    void divide(const T *a, T b, T *out, size_type n);                 \
+    void add(T a, const T *b, T *out, size_type n);                    \
+    void subtract(T a, const T *b, T *out, size_type n);               \
+    void multiply(T a, const T *b, T *out, size_type n);               \
+    void divide(T a, const T *b, T *out, size_type n);                 \
+    /* Sum of a[i] * b[i], floating types use eight partial sums */     \
+    T dot(const T *a, const T *b, size_type n);
+
+    ND_DECLARE_ELEMENTWISE_KERNELS(float)
+    ND_DECLARE_ELEMENTWISE_KERNELS(double)
+    ND_DECLARE_ELEMENTWISE_KERNELS(std::int32_t)
+
+#undef ND_DECLARE_ELEMENTWISE_KERNELS
+
+    // How conversions to integer types round, Nearest is ties to even
+    enum class Rounding : std::uint8_t
+    {
+        Nearest,
+        Truncate,
+        Floor,
+        Ceil,
+    };
+
+    // value * scale + offset in Acc converted to To. Integer results are
+    // rounded and then saturated to the range of To, NaN gives its lowest
+    // value. Used by the convert kernels and the generic loop of AsType.
+    template <Rounding Mode, typename To, typename Acc, typename From>
+    inline To convertValue(From value, Acc scale, Acc offset)
+    {
+        const Acc v = static_cast<Acc>(value) * scale + offset;
+        if constexpr (std::is_floating_point_v<To>)
+            return static_cast<To>(v);
+        else
+        {
+            Acc r;
+            if constexpr (Mode == Rounding::Nearest)
+                r = std::nearbyint(v);
+            else if constexpr (Mode == Rounding::Truncate)
+                r = std::trunc(v);
+            else if constexpr (Mode == Rounding::Floor)
+                r = std::floor(v);
+            else
+                r = std::ceil(v);
+
+            constexpr auto lo = static_cast<Acc>(std::numeric_limits<To>::lowest());
+            constexpr auto hi = static_cast<Acc>(std::numeric_limits<To>::max());
+            if constexpr (std::numeric_limits<To>::digits <= std::numeric_limits<Acc>::digits)
+            {
+                // Both bounds are exact, a branchless clamp that vectorizes
+                return static_cast<To>(std::min(std::max(lo, r), hi));
+            }
+            else
+            {
+                // hi rounded up to a power of two, e.g. 2^63 for int64
+                if (!(r > lo))
+                    return std::numeric_limits<To>::lowest();
+                if (r >= hi)
+                    return std::numeric_limits<To>::max();
+                return static_cast<To>(r);
+            }
+        }
+    }
+
+    // out[i] = convertValue(in[i], scale, offset) in Acc, with one loop
+    // per rounding mode so that each vectorizes without a branch
+    template <typename Acc, typename From, typename To>
+    inline void convertArray(const From *in, To *out, size_type n, double scale, double offset, Rounding rounding)
+    {
+        const auto s = static_cast<Acc>(scale);
+        const auto o = static_cast<Acc>(offset);
+        const auto loop = [&]<Rounding Mode>(std::integral_constant<Rounding, Mode>)
+        {
+            for (size_type i = 0; i < n; ++i)
+                out[i] = convertValue<Mode, To, Acc>(in[i], s, o);
+        };
+
+        if constexpr (std::is_floating_point_v<To>)
+            loop(std::integral_constant<Rounding, Rounding::Nearest>{});
+        else
+        {
+            switch (rounding)
+            {
+            case Rounding::Nearest:
+                loop(std::integral_constant<Rounding, Rounding::Nearest>{});
+                break;
+            case Rounding::Truncate:
+                loop(std::integral_constant<Rounding, Rounding::Truncate>{});
+                break;
+            case Rounding::Floor:
+                loop(std::integral_constant<Rounding, Rounding::Floor>{});
+                break;
+            case Rounding::Ceil:
+                loop(std::integral_constant<Rounding, Rounding::Ceil>{});
+                break;
+            }
+        }
+    }
+
+    // convertArray cloned for the conversions around float kernels
+    // Conversions from or to double compute in double, the others in
+    // float.
+#define ND_DECLARE_CONVERT_KERNELS(A, B)                                                              \
+    void convert(const A *in, B *out, size_type n, double scale, double offset, Rounding rounding); \
+    void convert(const B *in, A *out, size_type n, double scale, double offset, Rounding rounding);
+
+    ND_DECLARE_CONVERT_KERNELS(std::uint8_t, float)
+    ND_DECLARE_CONVERT_KERNELS(std::int16_t, float)
+    ND_DECLARE_CONVERT_KERNELS(std::uint8_t, double)
+    ND_DECLARE_CONVERT_KERNELS(float, double)
+
+#undef ND_DECLARE_CONVERT_KERNELS
+
+    // From to To has a convert kernel
+    template <typename From, typename To>
+    concept Converted = requires(const From *in, To *out) {
+        convert(in, out, size_type{0}, 1.0, 0.0, Rounding::Nearest);
+    };
+
+    // Bounds of the projections of n interleaved x, y points onto the
+    // axes (ux, uy) and (-uy, ux): minX, maxX, minY, maxY
+    void projectionBounds(const float *xy, size_type n, double ux, double uy, double bounds[4]);
+    void projectionBounds(const double *xy, size_type n, double ux, double uy, double bounds[4]);
+
+    // Weighted power sums of n <= 64 contiguous pixels: sum w, w i,
+    // w i^2 and w i^3 with i the offset in the block and w the pixel
+    // value, or 1 for nonzero pixels if binary
+    void pixelPowerSums(const std::uint8_t *row, size_type n, bool binary, std::int64_t sums[4]);
+
+    // ISA level the resolver picked on this host, e.g. "x86-64-v3"
+    const char *isaLevel();
+
+    /**************************************************************************/
+
+    void testKernels();
+
+} // namespace ND::Kernels
+
+#endif /* INCLUDE_CPP_EIGEN_OPENCV_SHARED_KERNELS_HPP */
@@ -0,0 +1,302 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Sparsh Jain
+ *
+ */
+
+#ifndef INCLUDE_CPP_EIGEN_OPENCV_SHARED_MOMENTS_HPP
+#define INCLUDE_CPP_EIGEN_OPENCV_SHARED_MOMENTS_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+#include <cpp_eigen_opencv/shared/ndarray.hpp>
+#include <cpp_eigen_opencv/shared/geometry.hpp>
+#include <cpp_eigen_opencv/shared/parallel.hpp>
+#include <cpp_eigen_opencv/shared/kernels.hpp>
+#include <cpp_eigen_opencv/shared/trace.hpp>
+
+namespace Geometry
+{
+    // Spatial, central and normalized central moments up to order 3,
+    // laid out like cv::Moments
+    struct Moments
+    {
+        double m00{}, m10{}, m01{}, m20{}, m11{}, m02{}, m30{}, m21{}, m12{}, m03{};
+        double mu20{}, mu11{}, mu02{}, mu30{}, mu21{}, mu12{}, mu03{};
+        double nu20{}, nu11{}, nu02{}, nu30{}, nu21{}, nu12{}, nu03{};
+    };
+
+    namespace Detail
+    {
+        // Raw sums in the order m00, m10, m01, m20, m11, m02, m30, m21, m12, m03
+        using SpatialSums = std::array<double, 10>;
+
+        inline void addSums(SpatialSums &total, const SpatialSums &part)
+        {
+            for (size_type k = 0; k < total.size(); ++k)
+                total[k] += part[k];
+        }
+
+        // Fills in the central and normalized moments from spatial sums
+        Moments completeMoments(const SpatialSums &spatial);
+
+        // Scales Green's theorem edge sums into moments of the enclosed
+        // region, independent of the contour orientation
+        Moments contourMoments(const SpatialSums &edgeSums);
+
+        // Green's theorem edge sums of the closed contour formed by rows
+        // [begin, end), one pass over the edges
+        template <Arithmetic T>
+        SpatialSums contourSums(
+            const NDArray<T, 2> &points,
+            const size_type begin,
+            const size_type end)
+        {
+            SpatialSums a{};
+            if (end <= begin)
+                return a;
+
+            double xPrev = static_cast<double>(points(end - 1, 0));
+            double yPrev = static_cast<double>(points(end - 1, 1));
+            for (auto k = begin; k < end; ++k)
+            {
+                const double x = static_cast<double>(points(k, 0));
+                const double y = static_cast<double>(points(k, 1));
+
+                const double dxy = xPrev * y - x * yPrev;
+                const double xSum = xPrev + x;
+                const double ySum = yPrev + y;
+                const double xPrev2 = xPrev * xPrev;
+                const double yPrev2 = yPrev * yPrev;
+                const double x2 = x * x;
+                const double y2 = y * y;
+
+                a[0] += dxy;
+                a[1] += dxy * xSum;
+                a[2] += dxy * ySum;
+                a[3] += dxy * (xPrev * xSum + x2);
+                a[4] += dxy * (xPrev * (ySum + yPrev) + x * (ySum + y));
+                a[5] += dxy * (yPrev * ySum + y2);
+                a[6] += dxy * xSum * (xPrev2 + x2);
+                a[7] += dxy * (xPrev2 * (3.0 * yPrev + y) + 2.0 * x * xPrev * ySum + x2 * (yPrev + 3.0 * y));
+                a[8] += dxy * (yPrev2 * (3.0 * xPrev + x) + 2.0 * y * yPrev * xSum + y2 * (xPrev + 3.0 * x));
+                a[9] += dxy * ySum * (yPrev2 + y2);
+
+                xPrev = x;
+                yPrev = y;
+            }
+
+            return a;
+        }
+
+        // Adds the moments of one image row. Columns are summed in blocks
+        // with block-local coordinates, small enough that 8 and 16-bit
+        // pixels accumulate exactly in int64 lanes, then shifted to the
+        // block origin in double.
+        template <Arithmetic T>
+        void accumulateImageRow(
+            const NDArray<T, 2> &image,
+            const size_type y,
+            const bool binary,
+            SpatialSums &sums)
+        {
+            using Acc = std::conditional_t<Integral<T> && sizeof(T) <= 2, std::int64_t, double>;
+            constexpr size_type Block = 64;
+
+            const auto cols = image.shape()[1];
+            if (cols == 0)
+                return;
+
+            const T *row = &image(y, 0);
+            const auto step = (cols < 2) ? size_type{1} : static_cast<size_type>(&image(y, 1) - row);
+
+            // Contiguous 8-bit rows, the common image case, use the cloned kernel
+            const bool bytes = std::same_as<T, std::uint8_t> && step == 1;
+
+            double r0 = 0.0, r1 = 0.0, r2 = 0.0, r3 = 0.0;
+            for (size_type x0 = 0; x0 < cols; x0 += Block)
+            {
+                const auto n = std::min(Block, cols - x0);
+
+                Acc t0{}, t1{}, t2{}, t3{};
+                if (bytes)
+                {
+                    if constexpr (std::same_as<T, std::uint8_t>)
+                    {
+                        std::int64_t block[4];
+                        Kernels::pixelPowerSums(row + x0, n, binary, block);
+                        t0 = block[0];
+                        t1 = block[1];
+                        t2 = block[2];
+                        t3 = block[3];
+                    }
+                }
+                else
+                {
+                    for (size_type i = 0; i < n; ++i)
+                    {
+                        const T value = row[(x0 + i) * step];
+                        const Acc w = binary ? static_cast<Acc>(value != T{}) : static_cast<Acc>(value);
+                        const auto xi = static_cast<Acc>(i);
+                        t0 += w;
+                        t1 += w * xi;
+                        t2 += w * xi * xi;
+                        t3 += w * xi * xi * xi;
+                    }
+                }
+
+                const auto X = static_cast<double>(x0);
+                const auto s0 = static_cast<double>(t0);
+                const auto s1 = static_cast<double>(t1);
+                const auto s2 = static_cast<double>(t2);
+                const auto s3 = static_cast<double>(t3);
+                r0 += s0;
+                r1 += s1 + X * s0;
+                r2 += s2 + X * (2.0 * s1 + X * s0);
+                r3 += s3 + X * (3.0 * s2 + X * (3.0 * s1 + X * s0));
+            }
+
+            const auto Y = static_cast<double>(y);
+            sums[0] += r0;
+            sums[1] += r1;
+            sums[2] += Y * r0;
+            sums[3] += r2;
+            sums[4] += Y * r1;
+            sums[5] += Y * Y * r0;
+            sums[6] += r3;
+            sums[7] += Y * r2;
+            sums[8] += Y * Y * r1;
+            sums[9] += Y * Y * Y * r0;
+        }
+    }
+
+    // Moments of the region enclosed by the first count rows of a closed
+    // contour, all if count < 0, like cv::moments on a contour
+    // Green's theorem over the edges, either orientation gives the same
+    // result. Degenerate contours with no area get all zero moments.
+    template <Arithmetic T>
+    Moments polygonMoments(
+        const NDArray<T, 2> &points,
+        const int count = -1)
+    {
+        const auto N = (count < 0) ? points.shape()[0] : static_cast<size_type>(count);
+        assert(N <= points.shape()[0]);
+
+        return Detail::contourMoments(Detail::contourSums(points, 0, N));
+    }
+
+    // Contour moments for many contours at once, contour c is rows
+    // [offsets[c], offsets[c + 1]) of one concatenated point array
+    // Contours are spread over threads.
+    template <Arithmetic T>
+    std::vector<Moments> polygonMomentsBatch(
+        const NDArray<T, 2> &points,
+        const std::vector<size_type> &offsets)
+    {
+        assert(!offsets.empty() && "offsets must hold at least one entry");
+        assert(offsets.back() <= points.shape()[0]);
+
+        const auto C = offsets.size() - 1;
+        std::vector<Moments> result(C);
+        Parallel::parallelFor(0, C, [&](size_type c)
+                              {
+                                  assert(offsets[c] <= offsets[c + 1] && "offsets must be increasing");
+                                  result[c] = Detail::contourMoments(
+                                      Detail::contourSums(points, offsets[c], offsets[c + 1])); }, 64);
+        return result;
+    }
+
+    template <Arithmetic T>
+    std::vector<Moments> polygonMomentsBatch(const std::vector<NDArray<T, 2>> &contours)
+    {
+        std::vector<Moments> result(contours.size());
+        Parallel::parallelFor(0, contours.size(), [&](size_type c)
+                              { result[c] = polygonMoments(contours[c]); }, 64);
+        return result;
+    }
+
+    // Moments of the first count rows as unit point masses, all if count < 0
+    template <Arithmetic T>
+    Moments pointMoments(
+        const NDArray<T, 2> &points,
+        const int count = -1)
+    {
+        TRACE_SCOPE("moments.pointMoments");
+        const auto N = (count < 0) ? points.shape()[0] : static_cast<size_type>(count);
+        assert(N <= points.shape()[0]);
+
+        const auto chunks = Parallel::chunkCount(N, 1 << 16);
+        std::vector<Detail::SpatialSums> partial(chunks, Detail::SpatialSums{});
+        Parallel::parallelForChunks(0, N, chunks, [&](size_type lo, size_type hi, size_type chunk)
+                                    {
+                                        Detail::SpatialSums sums{};
+                                        for (auto i = lo; i < hi; ++i)
+                                        {
+                                            const double x = static_cast<double>(points(i, 0));
+                                            const double y = static_cast<double>(points(i, 1));
+                                            const double x2 = x * x;
+                                            const double y2 = y * y;
+                                            sums[0] += 1.0;
+                                            sums[1] += x;
+                                            sums[2] += y;
+                                            sums[3] += x2;
+                                            sums[4] += x * y;
+                                            sums[5] += y2;
+                                            sums[6] += x2 * x;
+                                            sums[7] += x2 * y;
+                                            sums[8] += x * y2;
+                                            sums[9] += y2 * y;
+                                        }
+                                        partial[chunk] = sums; });
+
+        Detail::SpatialSums total{};
+        for (const auto &sums : partial)
+            Detail::addSums(total, sums);
+        return Detail::completeMoments(total);
+    }
+
+    // Moments of an image with x along columns and y along rows, like
+    // cv::moments on an array. With binary set every nonzero pixel has
+    // weight 1, which is the mask case.
+    // One pass over the pixels, rows are split over threads and partial
+    // sums are combined in row order.
+    template <Arithmetic T>
+    Moments imageMoments(
+        const NDArray<T, 2> &image,
+        const bool binary = false)
+    {
+        TRACE_SCOPE("moments.imageMoments");
+        const auto rows = image.shape()[0];
+        const auto cols = image.shape()[1];
+
+        const auto chunks = Parallel::chunkCount(rows, std::max<size_type>(1, (1 << 16) / std::max<size_type>(cols, 1)));
+        std::vector<Detail::SpatialSums> partial(chunks, Detail::SpatialSums{});
+        Parallel::parallelForChunks(0, rows, chunks, [&](size_type lo, size_type hi, size_type chunk)
+                                    {
+                                        TRACE_SCOPE("moments.imageMoments.rows");
+                                        Detail::SpatialSums sums{};
+                                        for (auto y = lo; y < hi; ++y)
+                                            Detail::accumulateImageRow(image, y, binary, sums);
+                                        partial[chunk] = sums; });
+
+        Detail::SpatialSums total{};
+        for (const auto &sums : partial)
+            Detail::addSums(total, sums);
+        return Detail::completeMoments(total);
+    }
+
+    // The seven Hu invariants of the normalized central moments, like
+    // cv::HuMoments
+    std::array<double, 7> huMoments(const Moments &moments);
+
+    /**************************************************************************/
+
+    void testMoments();
+
+} // namespace Geometry
+
+#endif /* INCLUDE_CPP_EIGEN_OPENCV_SHARED_MOMENTS_HPP */
@@ -15,6 +15,12 @@
 #include <concepts>
 #include <numeric>
 #include <cmath>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <cpp_eigen_opencv/shared/allocation_tracking.hpp>
+#include <cpp_eigen_opencv/shared/kernels.hpp>
 
 namespace ND
 {
@@ -42,8 +48,56 @@ namespace ND
     template <size_type NDim>
     using Stride = std::array<size_type, NDim>;
 
+    // Runtime typed array in dynarray.hpp, shares NDArray buffers
+    class DynArray;
+
+    // Copy-on-write wrapper, see NDArray::CopyOnWrite()
+    template <typename T, size_type NDim>
+    class CowArray;
+
+    // Rounding of AsType() to integer types
+    using Rounding = Kernels::Rounding;
+
+    namespace Detail
+    {
+        // Copies a rows x cols block read with the given strides into dst,
+        // whose rows are dstPitch elements apart. Halving the longer side
+        // until the block fits in L1 keeps both the reads and the writes
+        // local for any source strides and cache size, e.g. a transpose.
+        template <typename T>
+        void copyBlock(const T *src, size_type rowStride, size_type colStride,
+                       std::remove_const_t<T> *dst, size_type dstPitch, size_type rows, size_type cols)
+        {
+            constexpr size_type Leaf = 16;
+            if (rows <= Leaf && cols <= Leaf)
+            {
+                for (size_type i = 0; i < rows; ++i)
+                {
+                    for (size_type j = 0; j < cols; ++j)
+                        dst[i * dstPitch + j] = src[i * rowStride + j * colStride];
+                }
+                return;
+            }
+
+            if (rows >= cols)
+            {
+                const size_type half = rows / 2;
+                copyBlock(src, rowStride, colStride, dst, dstPitch, half, cols);
+                copyBlock(src + half * rowStride, rowStride, colStride, dst + half * dstPitch, dstPitch, rows - half, cols);
+            }
+            else
+            {
+                const size_type half = cols / 2;
+                copyBlock(src, rowStride, colStride, dst, dstPitch, rows, half);
+                copyBlock(src + half * colStride, rowStride, colStride, dst + half, dstPitch, rows, cols - half);
+            }
+        }
+    }
+
     // N-Dimensional Array Class
-    // Assumes contiguous storage in row-major order
+    // Owning arrays are contiguous in row-major order. Transpose(),
+    // Permute() and SwapAxes() return views with permuted strides, see
+    // IsContiguous() for what works on those.
     // Marked as final to prevent inheritance
     // If you want to inherit, make sure you follow the rule of 5
     // and ensure proper cleanup of resources
@@ -74,6 +128,59 @@ namespace ND
             return m_strides[static_cast<stride_size_type>(index)];
         }
 
+        // Writes the elements in row-major order to out, which holds m_size
+        // Strided arrays go through copyBlock over the last two axes.
+        void copyTo(std::remove_const_t<T> *out) const
+        {
+            if (IsContiguous())
+            {
+                std::copy(m_data, m_data + m_size, out);
+                return;
+            }
+
+            if constexpr (NDim == 1)
+            {
+                for (size_type i = 0; i < m_size; ++i)
+                    out[i] = m_data[i * m_strides[0]];
+            }
+            else
+            {
+                const size_type rows = m_shape[NDim - 2];
+                const size_type cols = m_shape[NDim - 1];
+                if (rows * cols == 0)
+                    return;
+
+                // Odometer over the leading axes
+                Shape<NDim - 2> index{};
+                for (size_type block = 0; block < m_size / (rows * cols); ++block)
+                {
+                    size_type offset = 0;
+                    for (size_type i = 0; i < NDim - 2; ++i)
+                        offset += index[i] * m_strides[i];
+
+                    Detail::copyBlock(m_data + offset, m_strides[NDim - 2], m_strides[NDim - 1],
+                                      out + block * rows * cols, cols, rows, cols);
+
+                    for (size_type i = NDim - 2; i > 0; --i)
+                    {
+                        if (++index[i - 1] < m_shape[i - 1])
+                            break;
+                        index[i - 1] = 0;
+                    }
+                }
+            }
+        }
+
+        // Same buffer and owner with another shape and strides
+        template <size_type M>
+        NDArray<T, M> view(Shape<M> shape, Stride<M> strides) const
+        {
+            auto arr = NDArray<T, M>(m_data, shape);
+            arr.m_owned_data = m_owned_data;
+            arr.m_strides = strides;
+            return arr;
+        }
+
         // Protected Owning Constructor
         explicit NDArray(std::shared_ptr<T[]> owned_data, Shape<NDim> shape)
             : NDArray(owned_data.get(), shape)
@@ -81,6 +188,11 @@ namespace ND
             m_owned_data = owned_data;
         }
 
+        friend class DynArray;
+
+        template <typename, size_type>
+        friend class NDArray;
+
     public:
         // Since we may own resources, we need to follow rule of 5
 
@@ -120,7 +232,7 @@ namespace ND
         // Public Owning Constructor only for 1D Array
         explicit NDArray(std::initializer_list<T> init)
             requires(NDim == 1)
-            : NDArray(std::make_shared<T[]>(init.size()), {init.size()})
+            : NDArray(Detail::allocateArray<T>(init.size()), {init.size()})
         {
             std::copy(init.begin(), init.end(), m_data);
         }
@@ -128,7 +240,7 @@ namespace ND
         // Factory Functions to create owning NDArray
         static NDArray<T, NDim> Empty(Shape<NDim> shape)
         {
-            auto owned_data = std::make_shared<T[]>(std::reduce(
+            auto owned_data = Detail::allocateArray<T>(std::reduce(
                 shape.begin(),
                 shape.end(),
                 static_cast<size_type>(1),
@@ -161,6 +273,110 @@ namespace ND
 
         inline constexpr Shape<NDim> shape() const { return m_shape; }
 
+        // In elements
+        inline constexpr Stride<NDim> strides() const { return m_strides; }
+
+        // True if the elements are in row-major order without gaps, which
+        // flat indexing with operator[], data() based loops and the kernels
+        // rely on. Axes of length 1 may have any stride. Views from
+        // Transpose() and friends are usually not, index them with
+        // operator() or call Contiguous() first. The element-wise operators
+        // and Copy() accept both.
+        inline constexpr bool IsContiguous() const
+        {
+            size_type expected = 1;
+            for (size_type i = NDim; i > 0; --i)
+            {
+                if (m_shape[i - 1] != 1 && m_strides[i - 1] != expected)
+                    return false;
+                expected *= m_shape[i - 1];
+            }
+            return true;
+        }
+
+        // Views
+        // These share the buffer and owner and run in O(NDim) without
+        // touching the elements.
+
+        // Same elements in row-major order with another shape of the same
+        // size. Strided arrays are copied first, like numpy.reshape.
+        template <size_type M>
+        NDArray<T, M> Reshape(Shape<M> shape) const
+        {
+            assert(std::reduce(shape.begin(), shape.end(), size_type{1}, std::multiplies<size_type>{}) == m_size &&
+                   "Size mismatch");
+
+            if (!IsContiguous())
+                return Copy().Reshape(shape);
+
+            Stride<M> strides{};
+            size_type stride = 1;
+            for (size_type i = M; i > 0; --i)
+            {
+                strides[i - 1] = stride;
+                stride *= shape[i - 1];
+            }
+            return view(shape, strides);
+        }
+
+        // Axis i of the result is axis axes[i] of this array
+        NDArray<T, NDim> Permute(Shape<NDim> axes) const
+        {
+#ifndef NDEBUG
+            std::array<bool, NDim> seen{};
+            for (const auto axis : axes)
+            {
+                assert(axis < NDim && !seen[axis] && "Not a permutation");
+                seen[axis] = true;
+            }
+#endif
+
+            Shape<NDim> shape{};
+            Stride<NDim> strides{};
+            for (size_type i = 0; i < NDim; ++i)
+            {
+                shape[i] = m_shape[axes[i]];
+                strides[i] = m_strides[axes[i]];
+            }
+            return view(shape, strides);
+        }
+
+        // Reverses the axes, the matrix transpose for NDim == 2
+        NDArray<T, NDim> Transpose() const
+        {
+            Shape<NDim> axes{};
+            for (size_type i = 0; i < NDim; ++i)
+                axes[i] = NDim - 1 - i;
+            return Permute(axes);
+        }
+
+        NDArray<T, NDim> SwapAxes(size_type a, size_type b) const
+        {
+            assert(a < NDim && b < NDim && "Axis out of bounds");
+            Shape<NDim> axes{};
+            std::iota(axes.begin(), axes.end(), size_type{0});
+            std::swap(axes[a], axes[b]);
+            return Permute(axes);
+        }
+
+        // This array if it is contiguous, otherwise Copy()
+        NDArray<T, NDim> Contiguous() const
+        {
+            return IsContiguous() ? *this : Copy();
+        }
+
+        // Copy-on-write
+        // Returns a CowArray sharing this buffer, see there. The mode is a
+        // separate type so that element access on plain arrays stays a
+        // bare load or store the compiler can vectorize.
+        CowArray<T, NDim> CopyOnWrite() const
+        {
+            return CowArray<T, NDim>(*this);
+        }
+
+        // True if other arrays hold the same owned buffer
+        inline bool IsShared() const { return m_owned_data.use_count() > 1; }
+
         // Access
         inline T *data() { return m_data; }
 
@@ -205,16 +421,19 @@ namespace ND
             return offset;
         }
 
+        // Flat index in memory order, needs IsContiguous()
         inline T &operator[](size_type idx)
             requires(!std::is_const_v<T>)
         {
             assert(idx < m_size && "Index out of bounds");
+            assert(IsContiguous() && "Flat index into a strided view");
             return m_data[idx];
         }
 
         inline const T &operator[](size_type idx) const
         {
             assert(idx < m_size && "Index out of bounds");
+            assert(IsContiguous() && "Flat index into a strided view");
             return m_data[idx];
         }
 
@@ -232,31 +451,198 @@ namespace ND
         }
 
         // Copying
+        // The copy is contiguous, views are materialized in row-major order
         NDArray<T, NDim> Copy() const
         {
-            auto arr = Empty(m_shape);
-            std::copy(m_data, m_data + m_size, arr.m_data);
-            return arr;
+#ifdef ND_TRACK_ALLOCATIONS
+            Detail::recordCopy();
+#endif
+            auto owned_data = Detail::allocateArray<std::remove_const_t<T>>(m_size);
+            copyTo(owned_data.get());
+
+            return NDArray<T, NDim>(std::shared_ptr<T[]>(owned_data), m_shape);
         }
 
         static NDArray<T, NDim> Copy(const NDArray<T, NDim> &other)
         {
             return other.Copy();
         }
+
+        // Conversion
+        // Contiguous array of U holding value * scale + offset for every
+        // element, e.g. AsType<float>(1.0 / 255.0, 0.0) for an 8-bit image.
+        // Integer results are rounded and saturated to the range of U,
+        // NaN gives its lowest value. uint8, int16 and double to and from
+        // float, and uint8 to and from double, run vectorized kernels.
+        template <typename U>
+        NDArray<U, NDim> AsType(double scale, double offset, Rounding rounding = Rounding::Nearest) const
+        {
+            using From = std::remove_const_t<T>;
+
+            if (!IsContiguous()) [[unlikely]]
+                return Contiguous().template AsType<U>(scale, offset, rounding);
+
+            auto result = NDArray<U, NDim>::Empty(m_shape);
+            if constexpr (Kernels::Converted<From, U>)
+                Kernels::convert(m_data, result.m_data, m_size, scale, offset, rounding);
+            else
+            {
+                // Integer to integer stays exact for 64-bit values, which
+                // double would round
+                if constexpr (std::integral<From> && std::integral<U>)
+                {
+                    if (scale == 1.0 && offset == 0.0)
+                    {
+                        constexpr auto lo = std::numeric_limits<U>::lowest();
+                        constexpr auto hi = std::numeric_limits<U>::max();
+                        for (size_type i = 0; i < m_size; ++i)
+                        {
+                            const From v = m_data[i];
+                            result.m_data[i] = std::cmp_less(v, lo) ? lo : std::cmp_greater(v, hi) ? hi : static_cast<U>(v);
+                        }
+                        return result;
+                    }
+                }
+                Kernels::convertArray<double>(m_data, result.m_data, m_size, scale, offset, rounding);
+            }
+
+            return result;
+        }
+
+        template <typename U>
+        NDArray<U, NDim> AsType(Rounding rounding = Rounding::Nearest) const
+        {
+            return AsType<U>(1.0, 0.0, rounding);
+        }
     };
 
+    // Copy-on-write array, from NDArray::CopyOnWrite()
+    // Copies share the buffer, and writing to any of them through
+    // operator[], operator() or data() first gives that copy a private
+    // contiguous copy of the buffer if the buffer is still shared, so
+    // pipeline stages can pass arrays along without defensive Copy()
+    // calls. Non-const access counts as a write, read through a const
+    // reference to keep sharing. Every such access checks the use count,
+    // so loops with many writes should call Mutable() once and write to
+    // the plain array it returns. Arrays that shared the buffer before
+    // CopyOnWrite() still write to it in place, and non-owning arrays are
+    // never copied. As with std::shared_ptr::use_count, the check is only
+    // exact while no other thread copies or drops the array at the same
+    // time.
+    template <typename T, size_type NDim>
+    class CowArray final
+    {
+    public:
+        using value_type = T;
+        using size_type = ND::size_type;
+
+    private:
+        NDArray<T, NDim> m_array;
+
+        // Replaces a shared buffer with a private contiguous copy
+        inline void detach()
+        {
+            if (m_array.IsShared()) [[unlikely]]
+                m_array = m_array.Copy();
+        }
+
+    public:
+        explicit CowArray(NDArray<T, NDim> array)
+            : m_array(std::move(array))
+        {
+        }
+
+        // Queries
+        inline constexpr size_type ndim() const { return NDim; }
+        inline constexpr size_type size() const { return m_array.size(); }
+        inline constexpr Shape<NDim> shape() const { return m_array.shape(); }
+        inline constexpr Stride<NDim> strides() const { return m_array.strides(); }
+        inline constexpr bool IsContiguous() const { return m_array.IsContiguous(); }
+        inline bool IsShared() const { return m_array.IsShared(); }
+
+        // Views, copy-on-write like this array
+        template <size_type M>
+        CowArray<T, M> Reshape(Shape<M> shape) const
+        {
+            return CowArray<T, M>(m_array.Reshape(shape));
+        }
+
+        CowArray<T, NDim> Permute(Shape<NDim> axes) const { return CowArray(m_array.Permute(axes)); }
+        CowArray<T, NDim> Transpose() const { return CowArray(m_array.Transpose()); }
+        CowArray<T, NDim> SwapAxes(size_type a, size_type b) const { return CowArray(m_array.SwapAxes(a, b)); }
+
+        // Private contiguous copy, still copy-on-write
+        CowArray<T, NDim> Copy() const { return CowArray(m_array.Copy()); }
+
+        // The wrapped array for reading, e.g. as an operand of the
+        // element-wise operators
+        inline const NDArray<T, NDim> &Array() const { return m_array; }
+
+        // The wrapped array for writing, given a private buffer first
+        // It stays private until this CowArray is copied again.
+        inline NDArray<T, NDim> &Mutable()
+        {
+            detach();
+            return m_array;
+        }
+
+        // Access
+        inline T *data()
+        {
+            if constexpr (!std::is_const_v<T>)
+                detach();
+            return m_array.data();
+        }
+
+        inline const T *data() const { return m_array.data(); }
+
+        inline T &operator[](size_type idx)
+            requires(!std::is_const_v<T>)
+        {
+            detach();
+            return m_array[idx];
+        }
+
+        inline const T &operator[](size_type idx) const { return m_array[idx]; }
+
+        template <typename... Idx>
+        inline T &operator()(Idx... idx)
+            requires(!std::is_const_v<T>)
+        {
+            detach();
+            return m_array(idx...);
+        }
+
+        template <typename... Idx>
+        inline const T &operator()(Idx... idx) const
+        {
+            return m_array(idx...);
+        }
+    };
+
+    // Strided views are made contiguous first, so the loops and kernels
+    // below always run over flat buffers
     template <typename T, typename U, size_type NDim>
     auto operator+(const NDArray<T, NDim> &a, const NDArray<U, NDim> &b)
+        -> NDArray<decltype(std::declval<T>() + std::declval<U>()), NDim>
     {
         using ResultType = decltype(std::declval<T>() + std::declval<U>());
 
         assert(a.shape() == b.shape() && "Shape Mismatch");
 
+        if (!a.IsContiguous() || !b.IsContiguous()) [[unlikely]]
+            return a.Contiguous() + b.Contiguous();
+
         auto result = NDArray<ResultType, NDim>::Empty(a.shape());
 
-        for (size_type i{0}; i < a.size(); ++i)
+        if constexpr (Kernels::Dispatched<T, U>)
+            Kernels::add(a.data(), b.data(), result.data(), a.size());
+        else
         {
-            result[i] = a[i] + b[i];
+            for (size_type i{0}; i < a.size(); ++i)
+            {
+                result[i] = a[i] + b[i];
+            }
         }
 
         return result;
@@ -264,16 +650,25 @@ namespace ND
 
     template <typename T, typename U, size_type NDim>
     auto operator-(const NDArray<T, NDim> &a, const NDArray<U, NDim> &b)
+        -> NDArray<decltype(std::declval<T>() - std::declval<U>()), NDim>
     {
         using ResultType = decltype(std::declval<T>() - std::declval<U>());
 
         assert(a.shape() == b.shape() && "Shape Mismatch");
 
+        if (!a.IsContiguous() || !b.IsContiguous()) [[unlikely]]
+            return a.Contiguous() - b.Contiguous();
+
         auto result = NDArray<ResultType, NDim>::Empty(a.shape());
 
-        for (size_type i{0}; i < a.size(); ++i)
+        if constexpr (Kernels::Dispatched<T, U>)
+            Kernels::subtract(a.data(), b.data(), result.data(), a.size());
+        else
         {
-            result[i] = a[i] - b[i];
+            for (size_type i{0}; i < a.size(); ++i)
+            {
+                result[i] = a[i] - b[i];
+            }
         }
 
         return result;
@@ -281,16 +676,25 @@ namespace ND
 
     template <typename T, typename U, size_type NDim>
     auto operator*(const NDArray<T, NDim> &a, const NDArray<U, NDim> &b)
+        -> NDArray<decltype(std::declval<T>() * std::declval<U>()), NDim>
     {
         using ResultType = decltype(std::declval<T>() * std::declval<U>());
 
         assert(a.shape() == b.shape() && "Shape Mismatch");
 
+        if (!a.IsContiguous() || !b.IsContiguous()) [[unlikely]]
+            return a.Contiguous() * b.Contiguous();
+
         auto result = NDArray<ResultType, NDim>::Empty(a.shape());
 
-        for (size_type i{0}; i < a.size(); ++i)
+        if constexpr (Kernels::Dispatched<T, U>)
+            Kernels::multiply(a.data(), b.data(), result.data(), a.size());
+        else
         {
-            result[i] = a[i] * b[i];
+            for (size_type i{0}; i < a.size(); ++i)
+            {
+                result[i] = a[i] * b[i];
+            }
         }
 
         return result;
@@ -298,31 +702,52 @@ namespace ND
 
     template <typename T, typename U, size_type NDim>
     auto operator/(const NDArray<T, NDim> &a, const NDArray<U, NDim> &b)
+        -> NDArray<decltype(std::declval<T>() / std::declval<U>()), NDim>
     {
         using ResultType = decltype(std::declval<T>() / std::declval<U>());
 
         assert(a.shape() == b.shape() && "Shape Mismatch");
 
+        if (!a.IsContiguous() || !b.IsContiguous()) [[unlikely]]
+            return a.Contiguous() / b.Contiguous();
+
         auto result = NDArray<ResultType, NDim>::Empty(a.shape());
 
-        for (size_type i{0}; i < a.size(); ++i)
+        if constexpr (Kernels::Dispatched<T, U>)
+            Kernels::divide(a.data(), b.data(), result.data(), a.size());
+        else
         {
-            result[i] = a[i] / b[i];
+            for (size_type i{0}; i < a.size(); ++i)
+            {
+                result[i] = a[i] / b[i];
+            }
         }
 
         return result;
     }
 
+    // Array and scalar operands are converted to the result type first,
+    // as the usual arithmetic conversions would, so that int64 arrays
+    // with double scalars compile without conversion warnings
     template <typename T, typename U, size_type NDim>
     auto operator+(const NDArray<T, NDim> &a, const U &b)
+        -> NDArray<decltype(std::declval<T>() + std::declval<U>()), NDim>
     {
         using ResultType = decltype(std::declval<T>() + std::declval<U>());
 
+        if (!a.IsContiguous()) [[unlikely]]
+            return a.Contiguous() + b;
+
         auto result = NDArray<ResultType, NDim>::Empty(a.shape());
 
-        for (size_type i{0}; i < a.size(); ++i)
+        if constexpr (Kernels::Dispatched<T, U>)
+            Kernels::add(a.data(), b, result.data(), a.size());
+        else
         {
-            result[i] = a[i] + b;
+            for (size_type i{0}; i < a.size(); ++i)
+            {
+                result[i] = static_cast<ResultType>(a[i]) + static_cast<ResultType>(b);
+            }
         }
 
         return result;
@@ -330,14 +755,23 @@ namespace ND
 
     template <typename T, typename U, size_type NDim>
     auto operator-(const NDArray<T, NDim> &a, const U &b)
+        -> NDArray<decltype(std::declval<T>() - std::declval<U>()), NDim>
     {
         using ResultType = decltype(std::declval<T>() - std::declval<U>());
 
+        if (!a.IsContiguous()) [[unlikely]]
+            return a.Contiguous() - b;
+
         auto result = NDArray<ResultType, NDim>::Empty(a.shape());
 
-        for (size_type i{0}; i < a.size(); ++i)
+        if constexpr (Kernels::Dispatched<T, U>)
+            Kernels::subtract(a.data(), b, result.data(), a.size());
+        else
         {
-            result[i] = a[i] - b;
+            for (size_type i{0}; i < a.size(); ++i)
+            {
+                result[i] = static_cast<ResultType>(a[i]) - static_cast<ResultType>(b);
+            }
         }
 
         return result;
@@ -345,14 +779,23 @@ namespace ND
 
     template <typename T, typename U, size_type NDim>
     auto operator*(const NDArray<T, NDim> &a, const U &b)
+        -> NDArray<decltype(std::declval<T>() * std::declval<U>()), NDim>
     {
         using ResultType = decltype(std::declval<T>() * std::declval<U>());
 
+        if (!a.IsContiguous()) [[unlikely]]
+            return a.Contiguous() * b;
+
         auto result = NDArray<ResultType, NDim>::Empty(a.shape());
 
-        for (size_type i{0}; i < a.size(); ++i)
+        if constexpr (Kernels::Dispatched<T, U>)
+            Kernels::multiply(a.data(), b, result.data(), a.size());
+        else
         {
-            result[i] = a[i] * b;
+            for (size_type i{0}; i < a.size(); ++i)
+            {
+                result[i] = static_cast<ResultType>(a[i]) * static_cast<ResultType>(b);
+            }
         }
 
         return result;
@@ -360,14 +803,23 @@ namespace ND
 
     template <typename T, typename U, size_type NDim>
     auto operator/(const NDArray<T, NDim> &a, const U &b)
+        -> NDArray<decltype(std::declval<T>() / std::declval<U>()), NDim>
     {
         using ResultType = decltype(std::declval<T>() / std::declval<U>());
 
+        if (!a.IsContiguous()) [[unlikely]]
+            return a.Contiguous() / b;
+
         auto result = NDArray<ResultType, NDim>::Empty(a.shape());
 
-        for (size_type i{0}; i < a.size(); ++i)
+        if constexpr (Kernels::Dispatched<T, U>)
+            Kernels::divide(a.data(), b, result.data(), a.size());
+        else
         {
-            result[i] = a[i] / b;
+            for (size_type i{0}; i < a.size(); ++i)
+            {
+                result[i] = static_cast<ResultType>(a[i]) / static_cast<ResultType>(b);
+            }
         }
 
         return result;
@@ -375,13 +827,22 @@ namespace ND
 
     template <typename T, typename U, size_type NDim>
     auto operator+(const T &a, const NDArray<U, NDim> &b)
+        -> NDArray<decltype(std::declval<T>() + std::declval<U>()), NDim>
     {
         using ResultType = decltype(std::declval<T>() + std::declval<U>());
 
+        if (!b.IsContiguous()) [[unlikely]]
+            return a + b.Contiguous();
+
         auto result = NDArray<ResultType, NDim>::Empty(b.shape());
-        for (size_type i{0}; i < b.size(); ++i)
+        if constexpr (Kernels::Dispatched<T, U>)
+            Kernels::add(a, b.data(), result.data(), b.size());
+        else
         {
-            result[i] = a + b[i];
+            for (size_type i{0}; i < b.size(); ++i)
+            {
+                result[i] = static_cast<ResultType>(a) + static_cast<ResultType>(b[i]);
+            }
         }
 
         return result;
@@ -389,14 +850,23 @@ namespace ND
 
     template <typename T, typename U, size_type NDim>
     auto operator-(const T &a, const NDArray<U, NDim> &b)
+        -> NDArray<decltype(std::declval<T>() - std::declval<U>()), NDim>
     {
         using ResultType = decltype(std::declval<T>() - std::declval<U>());
 
+        if (!b.IsContiguous()) [[unlikely]]
+            return a - b.Contiguous();
+
         auto result = NDArray<ResultType, NDim>::Empty(b.shape());
 
-        for (size_type i{0}; i < b.size(); ++i)
+        if constexpr (Kernels::Dispatched<T, U>)
+            Kernels::subtract(a, b.data(), result.data(), b.size());
+        else
         {
-            result[i] = a - b[i];
+            for (size_type i{0}; i < b.size(); ++i)
+            {
+                result[i] = static_cast<ResultType>(a) - static_cast<ResultType>(b[i]);
+            }
         }
 
         return result;
@@ -404,13 +874,22 @@ namespace ND
 
     template <typename T, typename U, size_type NDim>
     auto operator*(const T &a, const NDArray<U, NDim> &b)
+        -> NDArray<decltype(std::declval<T>() * std::declval<U>()), NDim>
     {
         using ResultType = decltype(std::declval<T>() * std::declval<U>());
 
+        if (!b.IsContiguous()) [[unlikely]]
+            return a * b.Contiguous();
+
         auto result = NDArray<ResultType, NDim>::Empty(b.shape());
-        for (size_type i{0}; i < b.size(); ++i)
+        if constexpr (Kernels::Dispatched<T, U>)
+            Kernels::multiply(a, b.data(), result.data(), b.size());
+        else
         {
-            result[i] = a * b[i];
+            for (size_type i{0}; i < b.size(); ++i)
+            {
+                result[i] = static_cast<ResultType>(a) * static_cast<ResultType>(b[i]);
+            }
         }
 
         return result;
@@ -418,13 +897,22 @@ namespace ND
 
     template <typename T, typename U, size_type NDim>
     auto operator/(const T &a, const NDArray<U, NDim> &b)
+        -> NDArray<decltype(std::declval<T>() / std::declval<U>()), NDim>
     {
         using ResultType = decltype(std::declval<T>() / std::declval<U>());
 
+        if (!b.IsContiguous()) [[unlikely]]
+            return a / b.Contiguous();
+
         auto result = NDArray<ResultType, NDim>::Empty(b.shape());
-        for (size_type i{0}; i < b.size(); ++i)
+        if constexpr (Kernels::Dispatched<T, U>)
+            Kernels::divide(a, b.data(), result.data(), b.size());
+        else
         {
-            result[i] = a / b[i];
+            for (size_type i{0}; i < b.size(); ++i)
+            {
+                result[i] = static_cast<ResultType>(a) / static_cast<ResultType>(b[i]);
+            }
         }
 
         return result;
@@ -432,6 +920,176 @@ namespace ND
 
     /**************************************************************************/
 
+    // Index-driven selection
+    // take, compress and where return new contiguous arrays, strided views
+    // are made contiguous first. take and scatter move whole rows along
+    // the first axis, single elements for 1D arrays.
+
+    namespace Detail
+    {
+        // Hint only, random rows are fetched this many rows ahead from
+        // arrays too large for L2, smaller ones are faster without
+        inline constexpr size_type PrefetchDistance = 16;
+        inline constexpr size_type PrefetchMinBytes = size_type{1} << 18;
+
+        inline void prefetch([[maybe_unused]] const void *address)
+        {
+#if defined(__GNUC__)
+            __builtin_prefetch(address);
+#endif
+        }
+    }
+
+    // Contiguous integer indices, e.g. std::vector<size_type> from
+    // argSortPoints or an NDArray<int, 1>
+    template <typename I>
+    concept IndexArray = requires(const I &indices) {
+        { std::size(indices) } -> std::convertible_to<size_type>;
+        requires std::integral<std::remove_cvref_t<decltype(*std::data(indices))>>;
+    };
+
+    // Rows indices[k] of a, a[indices] in numpy
+    // The index stream is known in advance, so the rows a few iterations
+    // ahead are prefetched and random gathers from large arrays overlap
+    // their cache misses.
+    template <typename T, size_type NDim, IndexArray I>
+    NDArray<std::remove_const_t<T>, NDim> take(const NDArray<T, NDim> &a, const I &indices)
+    {
+        if (!a.IsContiguous()) [[unlikely]]
+            return take(a.Contiguous(), indices);
+
+        auto shape = a.shape();
+        const size_type rows = shape[0];
+        const size_type rowSize = rows == 0 ? 0 : a.size() / rows;
+        const auto *index = std::data(indices);
+        const auto count = static_cast<size_type>(std::size(indices));
+        shape[0] = count;
+
+        const size_type ahead = a.size() * sizeof(T) >= Detail::PrefetchMinBytes ? Detail::PrefetchDistance : count;
+        auto result = NDArray<std::remove_const_t<T>, NDim>::Empty(shape);
+        const T *src = a.data();
+        auto *dst = result.data();
+        for (size_type k = 0; k < count; ++k)
+        {
+            if (k + ahead < count)
+                Detail::prefetch(src + static_cast<size_type>(index[k + ahead]) * rowSize);
+
+            const auto row = static_cast<size_type>(index[k]);
+            assert(row < rows && "Index out of bounds");
+            if constexpr (NDim == 1)
+                dst[k] = src[row];
+            else
+                std::copy_n(src + row * rowSize, rowSize, dst + k * rowSize);
+        }
+
+        return result;
+    }
+
+    // Row k of values to row indices[k] of out, the inverse of take
+    // out must be contiguous, the last of repeated indices wins.
+    template <typename T, size_type NDim, IndexArray I>
+    void scatter(NDArray<T, NDim> &out, const I &indices, const NDArray<T, NDim> &values)
+    {
+        assert(out.IsContiguous() && "Scatter into a strided view");
+        if (!values.IsContiguous()) [[unlikely]]
+            return scatter(out, indices, values.Contiguous());
+
+        const auto *index = std::data(indices);
+        const auto count = static_cast<size_type>(std::size(indices));
+        const size_type rows = out.shape()[0];
+        const size_type rowSize = rows == 0 ? 0 : out.size() / rows;
+        assert(values.shape()[0] == count && values.size() == count * rowSize && "Shape Mismatch");
+
+        const size_type ahead = out.size() * sizeof(T) >= Detail::PrefetchMinBytes ? Detail::PrefetchDistance : count;
+        const T *src = values.data();
+        T *dst = out.data();
+        for (size_type k = 0; k < count; ++k)
+        {
+            if (k + ahead < count)
+                Detail::prefetch(dst + static_cast<size_type>(index[k + ahead]) * rowSize);
+
+            const auto row = static_cast<size_type>(index[k]);
+            assert(row < rows && "Index out of bounds");
+            if constexpr (NDim == 1)
+                dst[row] = src[k];
+            else
+                std::copy_n(src + k * rowSize, rowSize, dst + row * rowSize);
+        }
+    }
+
+    // Rows of a where mask is true, numpy.compress along the first axis
+    template <typename T, size_type NDim>
+    NDArray<std::remove_const_t<T>, NDim> compress(const NDArray<T, NDim> &a, const NDArray<bool, 1> &mask)
+    {
+        if (!a.IsContiguous()) [[unlikely]]
+            return compress(a.Contiguous(), mask);
+
+        auto shape = a.shape();
+        assert(mask.size() == shape[0] && "Shape Mismatch");
+        const size_type rowSize = shape[0] == 0 ? 0 : a.size() / shape[0];
+        const bool *keep = mask.data();
+        shape[0] = static_cast<size_type>(std::count(keep, keep + mask.size(), true));
+
+        auto result = NDArray<std::remove_const_t<T>, NDim>::Empty(shape);
+        const T *src = a.data();
+        auto *dst = result.data();
+        for (size_type row = 0; row < mask.size(); ++row)
+        {
+            if (keep[row])
+                dst = std::copy_n(src + row * rowSize, rowSize, dst);
+        }
+
+        return result;
+    }
+
+    // cond ? a : b element-wise, numpy.where
+    template <typename T, typename U, size_type NDim>
+    auto where(const NDArray<bool, NDim> &cond, const NDArray<T, NDim> &a, const NDArray<U, NDim> &b)
+        -> NDArray<std::common_type_t<std::remove_const_t<T>, std::remove_const_t<U>>, NDim>
+    {
+        using ResultType = std::common_type_t<std::remove_const_t<T>, std::remove_const_t<U>>;
+
+        assert(cond.shape() == a.shape() && a.shape() == b.shape() && "Shape Mismatch");
+
+        if (!cond.IsContiguous() || !a.IsContiguous() || !b.IsContiguous()) [[unlikely]]
+            return where(cond.Contiguous(), a.Contiguous(), b.Contiguous());
+
+        // Both sides are read, so the select compiles to a blend
+        auto result = NDArray<ResultType, NDim>::Empty(a.shape());
+        const bool *c = cond.data();
+        const T *x = a.data();
+        const U *y = b.data();
+        ResultType *out = result.data();
+        for (size_type i = 0; i < a.size(); ++i)
+            out[i] = c[i] ? static_cast<ResultType>(x[i]) : static_cast<ResultType>(y[i]);
+
+        return result;
+    }
+
+    template <typename T, typename U, size_type NDim>
+    auto where(const NDArray<bool, NDim> &cond, const NDArray<T, NDim> &a, const U &b)
+        -> NDArray<std::common_type_t<std::remove_const_t<T>, U>, NDim>
+    {
+        using ResultType = std::common_type_t<std::remove_const_t<T>, U>;
+
+        assert(cond.shape() == a.shape() && "Shape Mismatch");
+
+        if (!cond.IsContiguous() || !a.IsContiguous()) [[unlikely]]
+            return where(cond.Contiguous(), a.Contiguous(), b);
+
+        auto result = NDArray<ResultType, NDim>::Empty(a.shape());
+        const auto value = static_cast<ResultType>(b);
+        const bool *c = cond.data();
+        const T *x = a.data();
+        ResultType *out = result.data();
+        for (size_type i = 0; i < a.size(); ++i)
+            out[i] = c[i] ? static_cast<ResultType>(x[i]) : value;
+
+        return result;
+    }
+
+    /**************************************************************************/
+
     // Structural Concepts
     template <typename A>
     concept NDArrayLike = requires(A a) {
@@ -461,6 +1119,14 @@ namespace ND
 
         assert(a.shape()[0] == b.shape()[0] && "Shape Mismatch");
 
+        // Long contiguous vectors of one type go to the cloned kernel,
+        // which sums in a different order for floating types
+        if constexpr (Kernels::Dispatched<T, U> && requires { a.data(); b.data(); })
+        {
+            if (a.shape()[0] >= Kernels::MinDotSize)
+                return Kernels::dot(a.data(), b.data(), a.shape()[0]);
+        }
+
         ResultType result{0};
         for (size_type i{0}; i < a.shape()[0]; ++i)
         {
@@ -0,0 +1,116 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Sparsh Jain
+ *
+ */
+
+#ifndef INCLUDE_CPP_EIGEN_OPENCV_SHARED_PARALLEL_HPP
+#define INCLUDE_CPP_EIGEN_OPENCV_SHARED_PARALLEL_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <vector>
+#include <cpp_eigen_opencv/shared/ndarray.hpp>
+
+namespace Parallel
+{
+    using ND::size_type;
+
+    // Number of hardware threads, at least 1
+    inline size_type hardwareThreads()
+    {
+        return std::max<size_type>(1, std::thread::hardware_concurrency());
+    }
+
+    // Number of chunks to split n elements into so that every chunk
+    // has at least grain elements, capped at maxChunks
+    inline size_type chunkCount(
+        const size_type n,
+        const size_type grain,
+        const size_type maxChunks = hardwareThreads())
+    {
+        if (n == 0)
+            return 0;
+
+        const auto chunks = (n + grain - 1) / std::max<size_type>(grain, 1);
+        return std::clamp<size_type>(chunks, 1, std::max<size_type>(maxChunks, 1));
+    }
+
+    // Split [begin, end) into chunks contiguous ranges and call
+    // f(chunkBegin, chunkEnd, chunkIndex) for each of them
+    // Chunk 0 runs on the calling thread, the others on their own thread
+    // Chunk boundaries only depend on (begin, end, chunks)
+    template <typename F>
+    void parallelForChunks(
+        const size_type begin,
+        const size_type end,
+        const size_type chunks,
+        F &&f)
+    {
+        const auto n = end - begin;
+        if (chunks <= 1 || n <= 1)
+        {
+            if (n > 0 || chunks > 0)
+                f(begin, end, static_cast<size_type>(0));
+            return;
+        }
+
+        const auto bound = [&](size_type c)
+        { return begin + n * c / chunks; };
+
+        std::vector<std::jthread> workers;
+        workers.reserve(chunks - 1);
+        for (size_type c = 1; c < chunks; ++c)
+        {
+            workers.emplace_back([&f, lo = bound(c), hi = bound(c + 1), c]()
+                                 { f(lo, hi, c); });
+        }
+
+        f(begin, bound(1), static_cast<size_type>(0));
+    }
+
+    // Call f(i) for every i in [begin, end), at least grain indices per thread
+    template <typename F>
+    void parallelFor(
+        const size_type begin,
+        const size_type end,
+        F &&f,
+        const size_type grain = 1024)
+    {
+        const auto chunks = chunkCount(end - begin, grain);
+        parallelForChunks(begin, end, chunks,
+                          [&f](size_type lo, size_type hi, size_type)
+                          {
+                              for (size_type i = lo; i < hi; ++i)
+                                  f(i);
+                          });
+    }
+
+    // Call f(rng, trial) for every trial in [0, trials) across the
+    // hardware threads, for randomized tests. Every trial draws from its
+    // own generator seeded with (seed, trial), so results do not depend
+    // on the thread count and a failing trial can be rerun on its own.
+    template <typename F>
+    void forEachTrial(
+        const size_type trials,
+        const std::uint32_t seed,
+        F &&f)
+    {
+        parallelForChunks(0, trials, chunkCount(trials, 1),
+                          [&f, seed](size_type lo, size_type hi, size_type)
+                          {
+                              for (size_type trial = lo; trial < hi; ++trial)
+                              {
+                                  std::seed_seq sequence{seed, static_cast<std::uint32_t>(trial)};
+                                  std::mt19937 rng(sequence);
+                                  f(rng, trial);
+                              }
+                          });
+    }
+
+} // namespace Parallel
+
+#endif /* INCLUDE_CPP_EIGEN_OPENCV_SHARED_PARALLEL_HPP */
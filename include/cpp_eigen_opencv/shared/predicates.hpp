@@ -0,0 +1,49 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Sparsh Jain
+ *
+ */
+
+#ifndef INCLUDE_CPP_EIGEN_OPENCV_SHARED_PREDICATES_HPP
+#define INCLUDE_CPP_EIGEN_OPENCV_SHARED_PREDICATES_HPP
+
+namespace Geometry
+{
+    // Robust geometric predicates on double coordinates
+    // The determinant is evaluated in floating point first and only
+    // recomputed with exact expansion arithmetic when the result is within
+    // the rounding error bound, so the sign is always exact.
+
+    // Positive if a, b, c are in counter-clockwise order,
+    // negative if clockwise and zero if collinear
+    double orient2d(
+        double ax, double ay,
+        double bx, double by,
+        double cx, double cy);
+
+    // Positive if d lies inside the circle through a, b, c
+    // (given in counter-clockwise order), negative if outside
+    // and zero if the four points are cocircular
+    double incircle(
+        double ax, double ay,
+        double bx, double by,
+        double cx, double cy,
+        double dx, double dy);
+
+    // Positive if d lies above the plane through a, b, c, where above is
+    // the side from which a, b, c appear counter-clockwise, negative if
+    // below and zero if the four points are coplanar
+    double orient3d(
+        double ax, double ay, double az,
+        double bx, double by, double bz,
+        double cx, double cy, double cz,
+        double dx, double dy, double dz);
+
+    /**************************************************************************/
+
+    void testPredicates();
+
+} // namespace Geometry
+
+#endif /* INCLUDE_CPP_EIGEN_OPENCV_SHARED_PREDICATES_HPP */
@@ -0,0 +1,62 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Sparsh Jain
+ *
+ */
+
+#ifndef INCLUDE_CPP_EIGEN_OPENCV_SHARED_QUICKHULL_HPP
+#define INCLUDE_CPP_EIGEN_OPENCV_SHARED_QUICKHULL_HPP
+
+#include <vector>
+#include <cpp_eigen_opencv/shared/ndarray.hpp>
+#include <cpp_eigen_opencv/shared/geometry.hpp>
+
+namespace Geometry
+{
+    // Closed triangle mesh over the rows of a point array
+    // Faces are counter-clockwise when seen from outside
+    struct TriangleMesh
+    {
+        std::vector<size_type> vertices{};  // rows used by the mesh, increasing
+        std::vector<size_type> triangles{}; // 3 rows per face
+
+        inline size_type numTriangles() const { return triangles.size() / 3; }
+    };
+
+    // Convex hull of the first count rows of an N x 3 array, all if count < 0
+    // Quickhull with exact orientation tests. Conflict lists are threaded
+    // through one per-point link array, so faces own no memory, and the
+    // points are partitioned over the faces in parallel.
+    // Coplanar hull faces stay separate triangles. Returns an empty mesh
+    // if all points are coplanar.
+    TriangleMesh convexHull3D(
+        const NDArray<double, 2> &points,
+        const int count = -1);
+
+    template <Arithmetic T>
+    TriangleMesh convexHull3D(
+        const NDArray<T, 2> &points,
+        const int count = -1)
+    {
+        const auto N = (count < 0) ? points.shape()[0] : static_cast<size_type>(count);
+        assert(N <= points.shape()[0]);
+        assert(points.shape()[1] == 3 && "convexHull3D expects 3D points");
+
+        auto converted = NDArray<double, 2>::Empty({N, 3});
+        for (size_type i = 0; i < N; ++i)
+        {
+            for (size_type d = 0; d < 3; ++d)
+                converted(i, d) = static_cast<double>(points(i, d));
+        }
+
+        return convexHull3D(converted);
+    }
+
+    /**************************************************************************/
+
+    void testConvexHull3D();
+
+} // namespace Geometry
+
+#endif /* INCLUDE_CPP_EIGEN_OPENCV_SHARED_QUICKHULL_HPP */
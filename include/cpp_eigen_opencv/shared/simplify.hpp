@@ -0,0 +1,295 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Sparsh Jain
+ *
+ */
+
+#ifndef INCLUDE_CPP_EIGEN_OPENCV_SHARED_SIMPLIFY_HPP
+#define INCLUDE_CPP_EIGEN_OPENCV_SHARED_SIMPLIFY_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+#include <cpp_eigen_opencv/shared/ndarray.hpp>
+#include <cpp_eigen_opencv/shared/geometry.hpp>
+
+namespace Geometry
+{
+    namespace Detail
+    {
+        // Distance from row p to the segment between rows a and b
+        template <Arithmetic T>
+        inline double segmentDistance(
+            const NDArray<T, 2> &points,
+            size_type p,
+            size_type a,
+            size_type b)
+        {
+            const double ax = static_cast<double>(points(a, 0));
+            const double ay = static_cast<double>(points(a, 1));
+            const double abx = static_cast<double>(points(b, 0)) - ax;
+            const double aby = static_cast<double>(points(b, 1)) - ay;
+            const double apx = static_cast<double>(points(p, 0)) - ax;
+            const double apy = static_cast<double>(points(p, 1)) - ay;
+
+            const double length2 = abx * abx + aby * aby;
+            const double t = (length2 > 0.0)
+                                 ? std::clamp((apx * abx + apy * aby) / length2, 0.0, 1.0)
+                                 : 0.0;
+
+            return std::hypot(apx - t * abx, apy - t * aby);
+        }
+
+        // Area of the triangle formed by rows a, b, c
+        template <Arithmetic T>
+        inline double triangleArea(
+            const NDArray<T, 2> &points,
+            size_type a,
+            size_type b,
+            size_type c)
+        {
+            const double ax = static_cast<double>(points(a, 0));
+            const double ay = static_cast<double>(points(a, 1));
+            const double abx = static_cast<double>(points(b, 0)) - ax;
+            const double aby = static_cast<double>(points(b, 1)) - ay;
+            const double acx = static_cast<double>(points(c, 0)) - ax;
+            const double acy = static_cast<double>(points(c, 1)) - ay;
+            return 0.5 * std::abs(abx * acy - aby * acx);
+        }
+
+        template <Arithmetic T>
+        NDArray<T, 2> gatherRows(
+            const NDArray<T, 2> &points,
+            const std::vector<size_type> &rows)
+        {
+            auto result = NDArray<T, 2>::Empty({rows.size(), 2});
+            for (size_type i = 0; i < rows.size(); ++i)
+            {
+                result(i, 0) = points(rows[i], 0);
+                result(i, 1) = points(rows[i], 1);
+            }
+            return result;
+        }
+    }
+
+    // Douglas-Peucker simplification of the first count rows of a polyline,
+    // all if count < 0, like cv::approxPolyDP
+    // Every dropped point is within epsilon of the simplified polyline.
+    // Iterative with an explicit stack, so long contours cannot overflow
+    // the call stack. Returns the kept rows in increasing order.
+    // A closed contour is split at the point farthest from its first point.
+    template <Arithmetic T>
+    std::vector<size_type> simplifyDouglasPeuckerIndices(
+        const NDArray<T, 2> &points,
+        const double epsilon,
+        const bool closed = false,
+        const int count = -1)
+    {
+        const auto N = (count < 0) ? points.shape()[0] : static_cast<size_type>(count);
+        assert(N <= points.shape()[0]);
+
+        std::vector<size_type> kept;
+        if (N <= 2)
+        {
+            for (size_type i = 0; i < N; ++i)
+                kept.push_back(i);
+            return kept;
+        }
+
+        // Ranges are in unwrapped positions, position N is row 0 again
+        const auto row = [N](size_type position)
+        { return position % N; };
+
+        std::vector<std::uint8_t> keep(N, 0);
+        std::vector<std::pair<size_type, size_type>> stack;
+        keep[0] = 1;
+
+        if (closed)
+        {
+            size_type far = 0;
+            double farDistance = -1.0;
+            for (size_type i = 1; i < N; ++i)
+            {
+                const double d = Detail::segmentDistance(points, i, 0, 0);
+                if (d > farDistance)
+                {
+                    farDistance = d;
+                    far = i;
+                }
+            }
+
+            keep[far] = 1;
+            stack.emplace_back(far, N);
+            stack.emplace_back(0, far);
+        }
+        else
+        {
+            keep[N - 1] = 1;
+            stack.emplace_back(0, N - 1);
+        }
+
+        while (!stack.empty())
+        {
+            const auto [lo, hi] = stack.back();
+            stack.pop_back();
+
+            size_type split = lo;
+            double splitDistance = epsilon;
+            for (auto position = lo + 1; position < hi; ++position)
+            {
+                const double d = Detail::segmentDistance(points, row(position), row(lo), row(hi));
+                if (d > splitDistance)
+                {
+                    splitDistance = d;
+                    split = position;
+                }
+            }
+
+            if (split == lo)
+                continue;
+
+            keep[row(split)] = 1;
+            stack.emplace_back(split, hi);
+            stack.emplace_back(lo, split);
+        }
+
+        for (size_type i = 0; i < N; ++i)
+        {
+            if (keep[i])
+                kept.push_back(i);
+        }
+        return kept;
+    }
+
+    template <Arithmetic T>
+    NDArray<T, 2> simplifyDouglasPeucker(
+        const NDArray<T, 2> &points,
+        const double epsilon,
+        const bool closed = false,
+        const int count = -1)
+    {
+        return Detail::gatherRows(points, simplifyDouglasPeuckerIndices(points, epsilon, closed, count));
+    }
+
+    // Visvalingam-Whyatt simplification of the first count rows of a
+    // polyline, all if count < 0
+    // Repeatedly removes the point whose triangle with its two neighbors
+    // has the smallest area, as long as that area is below minArea.
+    // A removed point's area carries over to its neighbors so the removal
+    // order stays monotonic. Uses a binary heap with lazy invalidation and
+    // an index linked list, O(n log n). Returns the kept rows in increasing
+    // order. The ends of an open polyline are always kept, a closed contour
+    // keeps at least three points.
+    template <Arithmetic T>
+    std::vector<size_type> simplifyVisvalingamIndices(
+        const NDArray<T, 2> &points,
+        const double minArea,
+        const bool closed = false,
+        const int count = -1)
+    {
+        const auto N = (count < 0) ? points.shape()[0] : static_cast<size_type>(count);
+        assert(N <= points.shape()[0]);
+
+        constexpr auto None = std::numeric_limits<size_type>::max();
+        const size_type minPoints = closed ? 3 : 2;
+
+        std::vector<size_type> kept;
+        if (N <= minPoints)
+        {
+            for (size_type i = 0; i < N; ++i)
+                kept.push_back(i);
+            return kept;
+        }
+
+        std::vector<size_type> prev(N), next(N);
+        std::vector<double> area(N, std::numeric_limits<double>::infinity());
+        for (size_type i = 0; i < N; ++i)
+        {
+            prev[i] = (i == 0) ? (closed ? N - 1 : None) : i - 1;
+            next[i] = (i == N - 1) ? (closed ? 0 : None) : i + 1;
+        }
+
+        struct Entry
+        {
+            double area;
+            size_type index;
+        };
+        const auto larger = [](const Entry &a, const Entry &b)
+        { return a.area > b.area || (a.area == b.area && a.index > b.index); };
+
+        std::vector<Entry> heap;
+        heap.reserve(3 * N);
+        for (size_type i = 0; i < N; ++i)
+        {
+            if (prev[i] != None && next[i] != None)
+            {
+                area[i] = Detail::triangleArea(points, prev[i], i, next[i]);
+                heap.push_back({area[i], i});
+            }
+        }
+        std::make_heap(heap.begin(), heap.end(), larger);
+
+        auto remaining = N;
+        std::vector<std::uint8_t> removed(N, 0);
+        while (!heap.empty() && remaining > minPoints)
+        {
+            std::pop_heap(heap.begin(), heap.end(), larger);
+            const auto [entryArea, i] = heap.back();
+            heap.pop_back();
+
+            // Stale entry, the area changed after it was pushed
+            if (removed[i] || entryArea != area[i])
+                continue;
+            if (entryArea >= minArea)
+                break;
+
+            removed[i] = 1;
+            --remaining;
+
+            const auto p = prev[i];
+            const auto n = next[i];
+            next[p] = n;
+            prev[n] = p;
+
+            for (const auto neighbor : {p, n})
+            {
+                if (prev[neighbor] == None || next[neighbor] == None)
+                    continue;
+
+                area[neighbor] = std::max(
+                    entryArea,
+                    Detail::triangleArea(points, prev[neighbor], neighbor, next[neighbor]));
+                heap.push_back({area[neighbor], neighbor});
+                std::push_heap(heap.begin(), heap.end(), larger);
+            }
+        }
+
+        for (size_type i = 0; i < N; ++i)
+        {
+            if (!removed[i])
+                kept.push_back(i);
+        }
+        return kept;
+    }
+
+    template <Arithmetic T>
+    NDArray<T, 2> simplifyVisvalingam(
+        const NDArray<T, 2> &points,
+        const double minArea,
+        const bool closed = false,
+        const int count = -1)
+    {
+        return Detail::gatherRows(points, simplifyVisvalingamIndices(points, minArea, closed, count));
+    }
+
+    /**************************************************************************/
+
+    void testSimplify();
+
+} // namespace Geometry
+
+#endif /* INCLUDE_CPP_EIGEN_OPENCV_SHARED_SIMPLIFY_HPP */
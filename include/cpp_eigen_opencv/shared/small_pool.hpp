@@ -0,0 +1,93 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Sparsh Jain
+ *
+ */
+
+#ifndef INCLUDE_CPP_EIGEN_OPENCV_SHARED_SMALL_POOL_HPP
+#define INCLUDE_CPP_EIGEN_OPENCV_SHARED_SMALL_POOL_HPP
+
+#include <cstddef>
+#include <memory>
+
+// Per-thread free lists for the buffers of tiny owning NDArrays
+// NDArray<double, 1>({x, y}) and the other temporaries of the geometry
+// code would otherwise each go through malloc and free. Buffers of at
+// most ND_SMALL_ARRAY_SIZE elements (default 8, 0 turns it off) are
+// carved from fixed size blocks that freed arrays leave on a list of
+// the freeing thread. The array still holds its buffer through the
+// same std::shared_ptr, so copies, views, copy-on-write and DynArray
+// share it as before. The macro changes NDArray itself, so it must be
+// the same in every translation unit.
+
+#ifndef ND_SMALL_ARRAY_SIZE
+#define ND_SMALL_ARRAY_SIZE 8
+#endif
+
+namespace ND
+{
+    inline constexpr std::size_t smallArraySize = ND_SMALL_ARRAY_SIZE;
+
+    namespace Detail
+    {
+        // Blocks come in multiples of SmallBlockAlign up to SmallBlockBytes,
+        // control block included
+        inline constexpr std::size_t SmallBlockAlign = 16;
+        inline constexpr std::size_t SmallBlockBytes = 256;
+
+        void *allocateSmallBlock(std::size_t bytes);
+        void deallocateSmallBlock(void *block, std::size_t bytes) noexcept;
+
+        // Blocks cached by the calling thread, for tests
+        std::size_t smallBlocksCached();
+
+        // For std::allocate_shared, larger or over-aligned requests go to
+        // std::allocator
+        template <typename T>
+        struct SmallBlockAllocator
+        {
+            using value_type = T;
+
+            SmallBlockAllocator() noexcept = default;
+
+            template <typename U>
+            SmallBlockAllocator(const SmallBlockAllocator<U> &) noexcept
+            {
+            }
+
+            static constexpr bool pooled(std::size_t n)
+            {
+                return alignof(T) <= SmallBlockAlign && n <= SmallBlockBytes / sizeof(T);
+            }
+
+            T *allocate(std::size_t n)
+            {
+                if (pooled(n))
+                    return static_cast<T *>(allocateSmallBlock(n * sizeof(T)));
+                return std::allocator<T>{}.allocate(n);
+            }
+
+            void deallocate(T *p, std::size_t n) noexcept
+            {
+                if (pooled(n))
+                    deallocateSmallBlock(p, n * sizeof(T));
+                else
+                    std::allocator<T>{}.deallocate(p, n);
+            }
+
+            template <typename U>
+            bool operator==(const SmallBlockAllocator<U> &) const noexcept
+            {
+                return true;
+            }
+        };
+    }
+
+    /**************************************************************************/
+
+    void testSmallPool();
+
+}
+
+#endif /* INCLUDE_CPP_EIGEN_OPENCV_SHARED_SMALL_POOL_HPP */
@@ -0,0 +1,308 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Sparsh Jain
+ *
+ */
+
+#ifndef INCLUDE_CPP_EIGEN_OPENCV_SHARED_SPATIAL_HASH_HPP
+#define INCLUDE_CPP_EIGEN_OPENCV_SHARED_SPATIAL_HASH_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include <cpp_eigen_opencv/shared/ndarray.hpp>
+#include <cpp_eigen_opencv/shared/geometry.hpp>
+#include <cpp_eigen_opencv/shared/parallel.hpp>
+
+namespace Geometry
+{
+    // Uniform grid over the plane with cells hashed into a fixed size table
+    // Built with a two-level counting sort: the points are first scattered
+    // into one contiguous range of buckets per thread, then every thread
+    // sorts its range into buckets on its own. The points of a bucket end
+    // up contiguous, nothing is allocated per cell and the extra memory is
+    // O(N + threads^2). Rebuilding reuses all buffers, which makes it
+    // cheap to rebuild every frame for moving points.
+    // Distinct cells may share a bucket, queries filter by actual distance.
+    template <Arithmetic T>
+    class SpatialHash final
+    {
+    private:
+        double m_cellSize{1.0};
+        double m_invCellSize{1.0};
+        size_type m_tableMask{0};
+
+        std::vector<size_type> m_bucketStart{}; // bucket -> first slot, tableSize + 1
+        std::vector<size_type> m_chunkCounts{}; // chunk x range histograms
+        std::vector<size_type> m_rangeStart{};  // range -> first slot, ranges + 1
+        std::vector<size_type> m_pointBucket{}; // point -> bucket
+        std::vector<size_type> m_rangeOrder{};  // points grouped by range
+        std::vector<size_type> m_slotIndex{};   // slot -> original point
+        std::vector<double> m_slotX{};          // slot -> x
+        std::vector<double> m_slotY{};          // slot -> y
+
+        inline std::int64_t cellCoordinate(double v) const
+        {
+            constexpr double limit = 4.0e18;
+            return static_cast<std::int64_t>(std::clamp(std::floor(v * m_invCellSize), -limit, limit));
+        }
+
+        inline size_type bucket(std::int64_t cx, std::int64_t cy) const
+        {
+            const auto h = (static_cast<std::uint64_t>(cx) * 73856093ULL) ^
+                           (static_cast<std::uint64_t>(cy) * 19349663ULL);
+            return static_cast<size_type>(h ^ (h >> 29)) & m_tableMask;
+        }
+
+        inline size_type tableSize() const { return m_tableMask + 1; }
+
+        // Call f(bucket) once for every distinct bucket overlapping the box
+        template <typename F>
+        void forEachBucket(double x0, double y0, double x1, double y1, F &&f) const
+        {
+            const auto cx0 = cellCoordinate(x0);
+            const auto cy0 = cellCoordinate(y0);
+            const auto cx1 = cellCoordinate(x1);
+            const auto cy1 = cellCoordinate(y1);
+
+            const auto cells = static_cast<double>(cx1 - cx0 + 1) *
+                               static_cast<double>(cy1 - cy0 + 1);
+            if (cells >= static_cast<double>(tableSize()))
+            {
+                for (size_type b = 0; b < tableSize(); ++b)
+                    f(b);
+                return;
+            }
+
+            // The common case of a 3x3 window is deduplicated on the stack,
+            // larger windows reuse a buffer of the calling thread
+            std::array<size_type, 9> small{};
+            thread_local std::vector<size_type> large{};
+            size_type count = 0;
+            const bool useSmall = cells <= 9.0;
+            if (!useSmall)
+                large.clear();
+
+            for (auto cy = cy0; cy <= cy1; ++cy)
+            {
+                for (auto cx = cx0; cx <= cx1; ++cx)
+                {
+                    const auto b = bucket(cx, cy);
+                    if (useSmall)
+                        small[count++] = b;
+                    else
+                        large.push_back(b);
+                }
+            }
+
+            if (useSmall)
+            {
+                // Insertion sort, at most 9 entries
+                for (size_type i = 1; i < count; ++i)
+                {
+                    const auto b = small[i];
+                    auto j = i;
+                    for (; j > 0 && small[j - 1] > b; --j)
+                        small[j] = small[j - 1];
+                    small[j] = b;
+                }
+                for (size_type i = 0; i < count; ++i)
+                {
+                    if (i == 0 || small[i] != small[i - 1])
+                        f(small[i]);
+                }
+            }
+            else
+            {
+                std::sort(large.begin(), large.end());
+                for (size_type i = 0; i < large.size(); ++i)
+                {
+                    if (i == 0 || large[i] != large[i - 1])
+                        f(large[i]);
+                }
+            }
+        }
+
+    public:
+        // cellSize should be close to the typical query radius
+        explicit SpatialHash(double cellSize)
+            : m_cellSize(cellSize),
+              m_invCellSize(1.0 / cellSize)
+        {
+            assert(cellSize > 0.0 && "Cell size must be positive");
+        }
+
+        // Queries
+        inline double cellSize() const { return m_cellSize; }
+
+        inline size_type size() const { return m_slotIndex.size(); }
+
+        // Rebuild from the first count rows of an N x 2 array, all if count < 0
+        void build(const NDArray<T, 2> &points, const int count = -1)
+        {
+            const auto N = (count < 0) ? points.shape()[0] : static_cast<size_type>(count);
+            assert(N <= points.shape()[0]);
+            assert(points.shape()[1] == 2 && "SpatialHash expects 2D points");
+
+            m_tableMask = std::bit_ceil(std::max<size_type>(N, 1)) - 1;
+            const auto buckets = tableSize();
+            const auto chunks = std::max<size_type>(Parallel::chunkCount(N, 16384), 1);
+
+            // Range r holds the buckets with r in their top bits
+            const auto ranges = std::min(std::bit_floor(chunks), buckets);
+            const auto shift = static_cast<size_type>(std::countr_zero(buckets / ranges));
+
+            m_bucketStart.assign(buckets + 1, 0);
+            m_chunkCounts.assign(chunks * ranges, 0);
+            m_rangeStart.resize(ranges + 1);
+            m_pointBucket.resize(N);
+            m_rangeOrder.resize(N);
+            m_slotIndex.resize(N);
+            m_slotX.resize(N);
+            m_slotY.resize(N);
+
+            // Pass 1: bucket of every point and per chunk range histograms
+            Parallel::parallelForChunks(0, N, chunks, [&](size_type lo, size_type hi, size_type c)
+                                        {
+                                            auto *counts = m_chunkCounts.data() + c * ranges;
+                                            for (size_type i = lo; i < hi; ++i)
+                                            {
+                                                const auto b = bucket(cellCoordinate(static_cast<double>(points(i, 0))),
+                                                                      cellCoordinate(static_cast<double>(points(i, 1))));
+                                                m_pointBucket[i] = b;
+                                                ++counts[b >> shift];
+                                            } });
+
+            // Exclusive prefix sum in (range, chunk) order, turning every
+            // histogram entry into the first position that chunk writes in
+            // that range
+            size_type offset = 0;
+            for (size_type r = 0; r < ranges; ++r)
+            {
+                m_rangeStart[r] = offset;
+                for (size_type c = 0; c < chunks; ++c)
+                {
+                    const auto n = m_chunkCounts[c * ranges + r];
+                    m_chunkCounts[c * ranges + r] = offset;
+                    offset += n;
+                }
+            }
+            m_rangeStart[ranges] = offset;
+            m_bucketStart[buckets] = offset;
+
+            // Pass 2: group the points by range, stable within every range
+            Parallel::parallelForChunks(0, N, chunks, [&](size_type lo, size_type hi, size_type c)
+                                        {
+                                            auto *next = m_chunkCounts.data() + c * ranges;
+                                            for (size_type i = lo; i < hi; ++i)
+                                                m_rangeOrder[next[m_pointBucket[i] >> shift]++] = i; });
+
+            // Pass 3: counting sort of every range into its own buckets and
+            // slots. The counts become bucket ends, and walking the range
+            // backwards moves them down to the bucket starts, stable within
+            // every bucket.
+            Parallel::parallelForChunks(0, ranges, ranges, [&](size_type lo, size_type hi, size_type)
+                                        {
+                                            for (size_type r = lo; r < hi; ++r)
+                                            {
+                                                const auto first = m_rangeStart[r];
+                                                const auto last = m_rangeStart[r + 1];
+                                                for (auto s = first; s < last; ++s)
+                                                    ++m_bucketStart[m_pointBucket[m_rangeOrder[s]]];
+
+                                                auto end = first;
+                                                for (auto b = r << shift; b < (r + 1) << shift; ++b)
+                                                {
+                                                    end += m_bucketStart[b];
+                                                    m_bucketStart[b] = end;
+                                                }
+
+                                                for (auto s = last; s > first; --s)
+                                                {
+                                                    const auto i = m_rangeOrder[s - 1];
+                                                    const auto slot = --m_bucketStart[m_pointBucket[i]];
+                                                    m_slotIndex[slot] = i;
+                                                    m_slotX[slot] = static_cast<double>(points(i, 0));
+                                                    m_slotY[slot] = static_cast<double>(points(i, 1));
+                                                }
+                                            } });
+        }
+
+        // Indices of all points within radius of (x, y), inclusive and unordered
+        void radiusSearch(double x, double y, double radius, std::vector<size_type> &out) const
+        {
+            out.clear();
+            if (size() == 0)
+                return;
+
+            const double r2 = radius * radius;
+            forEachBucket(x - radius, y - radius, x + radius, y + radius, [&](size_type b)
+                          {
+                              for (auto slot = m_bucketStart[b]; slot < m_bucketStart[b + 1]; ++slot)
+                              {
+                                  const double dx = m_slotX[slot] - x;
+                                  const double dy = m_slotY[slot] - y;
+                                  if (dx * dx + dy * dy <= r2)
+                                      out.push_back(m_slotIndex[slot]);
+                              } });
+        }
+
+        std::vector<size_type> radiusSearch(double x, double y, double radius) const
+        {
+            std::vector<size_type> out;
+            radiusSearch(x, y, radius, out);
+            return out;
+        }
+
+        // All pairs (i, j), i < j, of points within radius of each other
+        // Pairs are sorted lexicographically
+        std::vector<std::pair<size_type, size_type>> neighborPairs(double radius) const
+        {
+            const auto N = size();
+            const double r2 = radius * radius;
+            const auto chunks = std::max<size_type>(Parallel::chunkCount(N, 4096), 1);
+            std::vector<std::vector<std::pair<size_type, size_type>>> perChunk(chunks);
+
+            // Every slot looks for partners with a larger original index,
+            // so every pair is reported exactly once
+            Parallel::parallelForChunks(0, N, chunks, [&](size_type lo, size_type hi, size_type c)
+                                        {
+                                            auto &pairs = perChunk[c];
+                                            for (size_type s = lo; s < hi; ++s)
+                                            {
+                                                const auto i = m_slotIndex[s];
+                                                const auto x = m_slotX[s];
+                                                const auto y = m_slotY[s];
+                                                forEachBucket(x - radius, y - radius, x + radius, y + radius, [&](size_type b)
+                                                              {
+                                                                  for (auto slot = m_bucketStart[b]; slot < m_bucketStart[b + 1]; ++slot)
+                                                                  {
+                                                                      const auto j = m_slotIndex[slot];
+                                                                      const double dx = m_slotX[slot] - x;
+                                                                      const double dy = m_slotY[slot] - y;
+                                                                      if (j > i && dx * dx + dy * dy <= r2)
+                                                                          pairs.emplace_back(i, j);
+                                                                  } });
+                                            } });
+
+            std::vector<std::pair<size_type, size_type>> pairs;
+            for (const auto &chunk : perChunk)
+                pairs.insert(pairs.end(), chunk.begin(), chunk.end());
+            std::sort(pairs.begin(), pairs.end());
+
+            return pairs;
+        }
+    };
+
+    /**************************************************************************/
+
+    void testSpatialHash();
+
+} // namespace Geometry
+
+#endif /* INCLUDE_CPP_EIGEN_OPENCV_SHARED_SPATIAL_HASH_HPP */
@@ -0,0 +1,207 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Sparsh Jain
+ *
+ */
+
+#ifndef INCLUDE_CPP_EIGEN_OPENCV_SHARED_STREAMING_HULL_HPP
+#define INCLUDE_CPP_EIGEN_OPENCV_SHARED_STREAMING_HULL_HPP
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <future>
+#include <istream>
+#include <type_traits>
+#include <vector>
+#include <cpp_eigen_opencv/shared/ndarray.hpp>
+#include <cpp_eigen_opencv/shared/geometry.hpp>
+#include <cpp_eigen_opencv/shared/parallel.hpp>
+
+namespace Geometry
+{
+    // Source of points for the streaming hull: fills rows of buffer from
+    // the front and returns how many it wrote, 0 once the input is done.
+    // Calls never overlap but may come from a different thread.
+    template <typename R, typename T>
+    concept PointChunkReader = std::invocable<R &, NDArray<T, 2> &> &&
+                               std::convertible_to<std::invoke_result_t<R &, NDArray<T, 2> &>, size_type>;
+
+    namespace Detail
+    {
+        // Reads chunks into two alternating buffers and calls
+        // consume(chunk, rows) for each. The next chunk is read on another
+        // thread while the current one is consumed.
+        template <Arithmetic T, PointChunkReader<T> Reader, typename Consume>
+        void consumeChunks(
+            Reader &reader,
+            const size_type chunkRows,
+            Consume &&consume)
+        {
+            assert(chunkRows > 0 && "Chunks must hold at least one row");
+
+            std::array<NDArray<T, 2>, 2> buffers{NDArray<T, 2>::Empty({chunkRows, 2}),
+                                                 NDArray<T, 2>::Empty({chunkRows, 2})};
+            size_type current = 0;
+            size_type rows = reader(buffers[current]);
+            while (rows > 0)
+            {
+                assert(rows <= chunkRows && "Reader wrote past the buffer");
+
+                auto next = std::async(std::launch::async,
+                                       [&reader, &buffer = buffers[1 - current]]() -> size_type
+                                       { return reader(buffer); });
+                consume(static_cast<const NDArray<T, 2> &>(buffers[current]), rows);
+
+                rows = next.get();
+                current = 1 - current;
+            }
+        }
+    }
+
+    // Convex hull of a point stream that is fed chunk by chunk
+    // Only the running hull is kept, so memory is O(h + chunk size).
+    // Chunk points inside the running hull are dropped with an O(log h)
+    // test, in parallel, before the survivors are merged with the hull.
+    // For pixel integer types both tests are exact and the result is the
+    // same as computeConvexHull of all points. For floating types the test
+    // rounds other orientation triples than the monotone chain, so a point
+    // within rounding error of a hull edge may be dropped where the chain
+    // would have kept it as a nearly collinear vertex.
+    template <Arithmetic T>
+    class StreamingConvexHull final
+    {
+    private:
+        NDArray<T, 2> m_hull{NDArray<T, 2>::Empty({0, 2})};
+        std::vector<T> m_candidates{};       // interleaved x, y for the merge
+        std::vector<std::uint8_t> m_outside{}; // chunk row -> not inside hull
+
+    public:
+        // Merge the first count rows of a chunk, all if count < 0
+        void add(const NDArray<T, 2> &chunk, const int count = -1)
+        {
+            const auto N = (count < 0) ? chunk.shape()[0] : static_cast<size_type>(count);
+            assert(N <= chunk.shape()[0]);
+            assert(chunk.shape()[1] == 2 && "StreamingConvexHull expects 2D points");
+
+            const auto h = m_hull.shape()[0];
+            m_outside.assign(N, 1);
+            if (h >= 3)
+            {
+                Parallel::parallelFor(0, N, [&](size_type i)
+                                      { m_outside[i] = !Detail::insideConvex(m_hull, chunk(i, 0), chunk(i, 1)); }, 4096);
+            }
+
+            m_candidates.clear();
+            for (size_type i = 0; i < h; ++i)
+            {
+                m_candidates.push_back(m_hull(i, 0));
+                m_candidates.push_back(m_hull(i, 1));
+            }
+            for (size_type i = 0; i < N; ++i)
+            {
+                if (!m_outside[i])
+                    continue;
+
+                m_candidates.push_back(chunk(i, 0));
+                m_candidates.push_back(chunk(i, 1));
+            }
+
+            if (m_candidates.size() == 2 * h)
+                return;
+
+            const auto merged = NDArray<T, 2>(m_candidates.data(), {m_candidates.size() / 2, 2});
+            m_hull = computeConvexHull(merged);
+        }
+
+        // Queries
+        inline const NDArray<T, 2> &hull() const { return m_hull; }
+
+        inline RotatedRectangle minAreaRectangle() const
+        {
+            return Geometry::minAreaRectangle(m_hull);
+        }
+    };
+
+    // Convex hull of every point a reader produces, reading chunkRows rows
+    // at a time while the previous chunk is merged
+    template <Arithmetic T, PointChunkReader<T> Reader>
+    NDArray<T, 2> streamingConvexHull(
+        Reader &&reader,
+        const size_type chunkRows = size_type{1} << 16)
+    {
+        StreamingConvexHull<T> hull;
+        Detail::consumeChunks<T>(reader, chunkRows,
+                                 [&hull](const NDArray<T, 2> &chunk, size_type rows)
+                                 { hull.add(chunk, static_cast<int>(rows)); });
+        return hull.hull();
+    }
+
+    template <Arithmetic T, PointChunkReader<T> Reader>
+    RotatedRectangle streamingMinAreaRectangle(
+        Reader &&reader,
+        const size_type chunkRows = size_type{1} << 16)
+    {
+        return minAreaRectangle(streamingConvexHull<T>(std::forward<Reader>(reader), chunkRows));
+    }
+
+    // Reads interleaved x, y values of type T from a binary stream, such
+    // as a raw dump of an N x 2 array. A trailing partial point is dropped.
+    template <Arithmetic T>
+    class BinaryPointReader final
+    {
+    private:
+        std::istream *m_stream{nullptr};
+
+    public:
+        explicit BinaryPointReader(std::istream &stream)
+            : m_stream(&stream)
+        {
+        }
+
+        size_type operator()(NDArray<T, 2> &buffer)
+        {
+            m_stream->read(reinterpret_cast<char *>(buffer.data()),
+                           static_cast<std::streamsize>(buffer.size() * sizeof(T)));
+            return static_cast<size_type>(m_stream->gcount()) / (2 * sizeof(T));
+        }
+    };
+
+    // Serves consecutive windows of an N x 2 array, for example one that
+    // wraps a memory mapped file through the non-owning constructor
+    template <Arithmetic T>
+    class ArrayPointReader final
+    {
+    private:
+        NDArray<T, 2> m_points;
+        size_type m_next{0};
+
+    public:
+        explicit ArrayPointReader(const NDArray<T, 2> &points)
+            : m_points(points)
+        {
+        }
+
+        size_type operator()(NDArray<T, 2> &buffer)
+        {
+            const auto rows = std::min(buffer.shape()[0], m_points.shape()[0] - m_next);
+            for (size_type i = 0; i < rows; ++i)
+            {
+                buffer(i, 0) = m_points(m_next + i, 0);
+                buffer(i, 1) = m_points(m_next + i, 1);
+            }
+
+            m_next += rows;
+            return rows;
+        }
+    };
+
+    /**************************************************************************/
+
+    void testStreamingConvexHull();
+
+} // namespace Geometry
+
+#endif /* INCLUDE_CPP_EIGEN_OPENCV_SHARED_STREAMING_HULL_HPP */
@@ -0,0 +1,107 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Sparsh Jain
+ *
+ */
+
+#ifndef INCLUDE_CPP_EIGEN_OPENCV_SHARED_TRACE_HPP
+#define INCLUDE_CPP_EIGEN_OPENCV_SHARED_TRACE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+// Scoped timers around hot stages, opt-in like the allocation tracking
+// Build everything with -DND_TRACE (make TRACE=1) to record them. Without
+// it TRACE_SCOPE expands to nothing and no code is generated.
+//
+// Every thread records into its own fixed size ring buffer, so recording
+// takes no lock and the oldest events are overwritten when a thread
+// records more than Trace::bufferCapacity of them. Buffers are reused by
+// later threads once their thread exits, so short lived workers from
+// Parallel::parallelFor do not pile up buffers.
+
+#define TRACE_CONCAT_IMPL(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_IMPL(a, b)
+
+#ifdef ND_TRACE
+// name must be a string literal, only the pointer is stored
+#define TRACE_SCOPE(name) const Trace::ScopedTimer TRACE_CONCAT(traceScope, __LINE__)(name)
+#else
+#define TRACE_SCOPE(name) static_cast<void>(0)
+#endif // ND_TRACE
+
+namespace Trace
+{
+#ifdef ND_TRACE
+    inline constexpr bool enabled = true;
+#else
+    inline constexpr bool enabled = false;
+#endif
+
+    // Events kept per thread before the oldest are overwritten
+    inline constexpr std::size_t bufferCapacity = std::size_t{1} << 14;
+
+    struct Event
+    {
+        const char *name{nullptr};
+        std::int64_t startNs{0}; // since the first call to now()
+        std::int64_t durationNs{0};
+        std::uint32_t thread{0}; // ring buffer id, stable within a thread
+    };
+
+    // Monotonic nanoseconds since the first call
+    std::int64_t now();
+
+    // Appends one event to the calling thread's ring buffer
+    void record(const char *name, std::int64_t startNs, std::int64_t endNs);
+
+    // Events of all threads ordered by start time
+    // Only call while no thread is recording, a buffer that is written
+    // concurrently may return a torn event.
+    std::vector<Event> events();
+
+    // Drops all recorded events, same restriction as events()
+    void clear();
+
+    // Writes events as Chrome trace-event JSON, complete ("X") events in
+    // microseconds, loadable in chrome://tracing or Perfetto
+    void writeChromeTrace(std::ostream &out, const std::vector<Event> &events);
+
+    inline void writeChromeTrace(std::ostream &out)
+    {
+        writeChromeTrace(out, events());
+    }
+
+    class ScopedTimer final
+    {
+    private:
+        const char *m_name;
+        std::int64_t m_start;
+
+    public:
+        explicit ScopedTimer(const char *name)
+            : m_name(name), m_start(now())
+        {
+        }
+
+        ~ScopedTimer()
+        {
+            record(m_name, m_start, now());
+        }
+
+        ScopedTimer(const ScopedTimer &) = delete;
+        ScopedTimer &operator=(const ScopedTimer &) = delete;
+        ScopedTimer(ScopedTimer &&) = delete;
+        ScopedTimer &operator=(ScopedTimer &&) = delete;
+    };
+
+    /**************************************************************************/
+
+    void testTrace();
+
+} // namespace Trace
+
+#endif /* INCLUDE_CPP_EIGEN_OPENCV_SHARED_TRACE_HPP */
@@ -7,27 +7,103 @@
 
 #include <opencv2/opencv.hpp>
 #include <Eigen/Dense>
+#include <algorithm>
+#include <cstdint>
 #include <iostream>
+#include <string>
 #include <cpp_eigen_opencv/shared/ndarray.hpp>
+#include <cpp_eigen_opencv/shared/kernels.hpp>
+#include <cpp_eigen_opencv/shared/dynarray.hpp>
+#include <cpp_eigen_opencv/shared/allocation_tracking.hpp>
+#include <cpp_eigen_opencv/shared/small_pool.hpp>
+#include <cpp_eigen_opencv/shared/trace.hpp>
+#include <cpp_eigen_opencv/shared/batch.hpp>
 #include <cpp_eigen_opencv/shared/geometry.hpp>
+#include <cpp_eigen_opencv/shared/kdtree.hpp>
+#include <cpp_eigen_opencv/shared/spatial_hash.hpp>
+#include <cpp_eigen_opencv/shared/predicates.hpp>
+#include <cpp_eigen_opencv/shared/delaunay.hpp>
+#include <cpp_eigen_opencv/shared/calipers.hpp>
+#include <cpp_eigen_opencv/shared/simplify.hpp>
+#include <cpp_eigen_opencv/shared/quickhull.hpp>
+#include <cpp_eigen_opencv/shared/moments.hpp>
+#include <cpp_eigen_opencv/shared/distance_transform.hpp>
+#include <cpp_eigen_opencv/shared/streaming_hull.hpp>
 
-int main()
+namespace
 {
-    auto m = Eigen::Matrix3f::Identity();
-    std::cout << "Eigen matrix:\n"
-              << m << std::endl;
+    void runTests()
+    {
+        auto m = Eigen::Matrix3f::Identity();
+        std::cout << "Eigen matrix:\n"
+                  << m << std::endl;
+
+        ND::test();
+        ND::Kernels::testKernels();
+        ND::testDynArray();
+        ND::testAllocationTracking();
+        ND::testSmallPool();
+        Trace::testTrace();
+        Batch::testBatch();
+        Geometry::testConvexHull();
+        Geometry::testMinAreaRectangle();
+        Geometry::testIntegerGeometry();
+        Geometry::testKDTree();
+        Geometry::testSpatialHash();
+        Geometry::testPredicates();
+        Geometry::testDelaunay();
+        Geometry::testCalipers();
+        Geometry::testSimplify();
+        Geometry::testConvexHull3D();
+        Geometry::testMoments();
+        Geometry::testDistanceTransform();
+        Geometry::testStreamingConvexHull();
+    }
+
+    void showWindow()
+    {
+        auto img = cv::Mat::zeros(200, 200, CV_8UC3);
+        cv::imshow("Test", img);
+        while (cv::getWindowProperty("Test", cv::WND_PROP_VISIBLE) > 0)
+        {
+            cv::waitKey(1000);
+        }
+        cv::destroyAllWindows();
+    }
+
+    // Any format OpenCV can decode, as 8-bit grayscale
+    bool readImage(const std::string &path, ND::NDArray<std::uint8_t, 2> &image)
+    {
+        const auto mat = cv::imread(path, cv::IMREAD_GRAYSCALE);
+        if (mat.empty())
+            return false;
+
+        const auto rows = static_cast<ND::size_type>(mat.rows);
+        const auto cols = static_cast<ND::size_type>(mat.cols);
+        image = ND::NDArray<std::uint8_t, 2>::Empty({rows, cols});
+        for (int y = 0; y < mat.rows; ++y)
+            std::copy(mat.ptr<std::uint8_t>(y), mat.ptr<std::uint8_t>(y) + cols, &image(static_cast<ND::size_type>(y), 0));
+        return true;
+    }
+}
+
+// test (default) runs the self tests, show additionally opens a window
+// and batch runs the headless pipeline, see batch.hpp
+int main(int argc, char **argv)
+{
+    const std::string command = (argc > 1) ? argv[1] : "test";
 
-    ND::test();
-    Geometry::testConvexHull();
-    Geometry::testMinAreaRectangle();
+    if (command == "batch")
+        return Batch::main(argc - 2, argv + 2, readImage);
 
-    auto img = cv::Mat::zeros(200, 200, CV_8UC3);
-    cv::imshow("Test", img);
-    while (cv::getWindowProperty("Test", cv::WND_PROP_VISIBLE) > 0)
+    if (command == "test" || command == "show")
     {
-        cv::waitKey(1000);
+        runTests();
+        if (command == "show")
+            showWindow();
+        return 0;
     }
-    cv::destroyAllWindows();
 
-    return 0;
+    std::cerr << "usage: " << argv[0] << " [test | show | batch options inputs...]" << std::endl;
+    return 2;
 }
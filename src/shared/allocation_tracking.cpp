@@ -0,0 +1,201 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Sparsh Jain
+ *
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <mutex>
+#include <vector>
+
+#include <cpp_eigen_opencv/shared/ndarray.hpp>
+#include <cpp_eigen_opencv/shared/allocation_tracking.hpp>
+#include <cpp_eigen_opencv/shared/parallel.hpp>
+#include <cpp_eigen_opencv/shared/debug.hpp>
+
+namespace ND
+{
+    namespace
+    {
+        // Totals are plain atomics, the registry lock is only taken while a
+        // scope is open, so tracked builds without scopes stay cheap
+        std::atomic<std::uint64_t> g_allocations{0};
+        std::atomic<std::uint64_t> g_deallocations{0};
+        std::atomic<std::uint64_t> g_bytes{0};
+        std::atomic<std::uint64_t> g_copies{0};
+        std::atomic<std::int64_t> g_liveBytes{0};
+        std::atomic<std::uint64_t> g_peakLiveBytes{0};
+
+        std::atomic<int> g_openScopes{0};
+
+        std::mutex &registryMutex()
+        {
+            static std::mutex mutex;
+            return mutex;
+        }
+
+        std::vector<AllocationScope *> &registry()
+        {
+            static std::vector<AllocationScope *> scopes;
+            return scopes;
+        }
+    }
+
+    namespace Detail
+    {
+        void recordAllocation(std::size_t bytes)
+        {
+            g_allocations.fetch_add(1, std::memory_order_relaxed);
+            g_bytes.fetch_add(bytes, std::memory_order_relaxed);
+            const auto live = g_liveBytes.fetch_add(static_cast<std::int64_t>(bytes), std::memory_order_relaxed) +
+                              static_cast<std::int64_t>(bytes);
+
+            const auto liveBytes = static_cast<std::uint64_t>(std::max<std::int64_t>(live, 0));
+            auto peak = g_peakLiveBytes.load(std::memory_order_relaxed);
+            while (peak < liveBytes && !g_peakLiveBytes.compare_exchange_weak(peak, liveBytes, std::memory_order_relaxed))
+            {
+            }
+
+            if (g_openScopes.load(std::memory_order_acquire) > 0)
+            {
+                const std::lock_guard lock(registryMutex());
+                for (auto *scope : registry())
+                    scope->observeLiveBytes(live);
+            }
+        }
+
+        void recordDeallocation(std::size_t bytes)
+        {
+            g_deallocations.fetch_add(1, std::memory_order_relaxed);
+            g_liveBytes.fetch_sub(static_cast<std::int64_t>(bytes), std::memory_order_relaxed);
+        }
+
+        void recordCopy()
+        {
+            g_copies.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    AllocationStats allocationStats()
+    {
+        AllocationStats stats{};
+        stats.allocations = g_allocations.load(std::memory_order_relaxed);
+        stats.deallocations = g_deallocations.load(std::memory_order_relaxed);
+        stats.bytes = g_bytes.load(std::memory_order_relaxed);
+        stats.copies = g_copies.load(std::memory_order_relaxed);
+        stats.liveBytes = g_liveBytes.load(std::memory_order_relaxed);
+        stats.peakLiveBytes = g_peakLiveBytes.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    std::ostream &operator<<(std::ostream &out, const AllocationStats &stats)
+    {
+        return out << stats.allocations << " allocations (" << stats.bytes << " bytes), "
+                   << stats.deallocations << " deallocations, "
+                   << stats.copies << " copies, "
+                   << stats.liveBytes << " live bytes, "
+                   << stats.peakLiveBytes << " peak live bytes";
+    }
+
+    AllocationScope::AllocationScope()
+        : m_start()
+    {
+        const std::lock_guard lock(registryMutex());
+        m_start = allocationStats();
+        registry().push_back(this);
+        g_openScopes.fetch_add(1, std::memory_order_release);
+    }
+
+    AllocationScope::~AllocationScope()
+    {
+        const std::lock_guard lock(registryMutex());
+        auto &scopes = registry();
+        scopes.erase(std::find(scopes.begin(), scopes.end(), this));
+        g_openScopes.fetch_sub(1, std::memory_order_release);
+    }
+
+    void AllocationScope::observeLiveBytes(std::int64_t liveBytes)
+    {
+        const auto change = liveBytes - m_start.liveBytes;
+        if (change > 0)
+            m_peak = std::max(m_peak, static_cast<std::uint64_t>(change));
+    }
+
+    AllocationStats AllocationScope::stats() const
+    {
+        const std::lock_guard lock(registryMutex());
+        const auto now = allocationStats();
+
+        AllocationStats stats{};
+        stats.allocations = now.allocations - m_start.allocations;
+        stats.deallocations = now.deallocations - m_start.deallocations;
+        stats.bytes = now.bytes - m_start.bytes;
+        stats.copies = now.copies - m_start.copies;
+        stats.liveBytes = now.liveBytes - m_start.liveBytes;
+        stats.peakLiveBytes = m_peak;
+        return stats;
+    }
+
+    void testAllocationTracking()
+    {
+        std::cout << "Running tests for allocation tracking..." << std::endl;
+
+        const AllocationScope outer;
+        {
+            const AllocationScope scope;
+            {
+                const auto a = NDArray<double, 2>::Zeros({10, 20});
+                const auto b = a.Copy();
+                const auto view = NDArray<const double, 2>(a.data(), {20, 10});
+                const auto shallow = b;
+                const auto c = NDArray<int, 1>({1, 2, 3});
+
+                // Only the write to a shared copy-on-write buffer copies
+                auto d = NDArray<int, 1>({4, 5, 6}).CopyOnWrite();
+                d[0] = 7;
+                auto e = d;
+                e[1] = 8;
+            }
+
+            DEBUG_ONLY const auto stats = scope.stats();
+            if constexpr (allocationTrackingEnabled)
+            {
+                // Views and shallow copies do not allocate
+                assert(stats.allocations == 5 && "Unexpected allocation count");
+                assert(stats.deallocations == 5 && "Unexpected deallocation count");
+                assert(stats.bytes == 2 * 200 * sizeof(double) + 9 * sizeof(int) && "Unexpected byte count");
+                assert(stats.copies == 2 && "Unexpected copy count");
+                assert(stats.liveBytes == 0 && "Buffers leaked");
+                assert(stats.peakLiveBytes == stats.bytes && "Unexpected peak");
+            }
+            else
+            {
+                assert(stats.allocations == 0 && stats.bytes == 0 && stats.copies == 0 &&
+                       "Counters moved without ND_TRACK_ALLOCATIONS");
+            }
+        }
+
+        // Allocations on worker threads land in the scope too
+        const AllocationScope scope;
+        std::vector<NDArray<float, 1>> arrays;
+        for (size_type i = 0; i < 64; ++i)
+            arrays.push_back(NDArray<float, 1>::Empty({1}));
+        Parallel::parallelFor(0, arrays.size(), [&arrays](size_type i)
+                              { arrays[i] = NDArray<float, 1>::Full({i + 1}, 1.0f); }, 1);
+
+        DEBUG_ONLY const auto stats = scope.stats();
+        DEBUG_ONLY const auto outerStats = outer.stats();
+        if constexpr (allocationTrackingEnabled)
+        {
+            assert(stats.allocations == 128 && "Threaded allocations missed");
+            assert(stats.bytes == (64 + 64 * 65 / 2) * sizeof(float) && "Threaded bytes missed");
+            assert(stats.liveBytes == static_cast<std::int64_t>(64 * 65 / 2 * sizeof(float)) && "Live bytes mismatch");
+            assert(outerStats.allocations == 133 && "Nested scopes disagree");
+            assert(outerStats.peakLiveBytes >= static_cast<std::uint64_t>(stats.liveBytes) && "Outer peak too low");
+        }
+    }
+
+}
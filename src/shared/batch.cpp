@@ -0,0 +1,755 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Sparsh Jain
+ *
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <chrono>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <sstream>
+#include <thread>
+
+#include <cpp_eigen_opencv/shared/batch.hpp>
+#include <cpp_eigen_opencv/shared/dynarray.hpp>
+#include <cpp_eigen_opencv/shared/geometry.hpp>
+#include <cpp_eigen_opencv/shared/calipers.hpp>
+#include <cpp_eigen_opencv/shared/moments.hpp>
+#include <cpp_eigen_opencv/shared/distance_transform.hpp>
+#include <cpp_eigen_opencv/shared/parallel.hpp>
+#include <cpp_eigen_opencv/shared/trace.hpp>
+#include <cpp_eigen_opencv/shared/debug.hpp>
+
+namespace Batch
+{
+    namespace
+    {
+        constexpr Stage AllStages[] = {Stage::Hull, Stage::Rectangle, Stage::Diameter, Stage::Width,
+                                       Stage::ClosestPair, Stage::Moments, Stage::DistanceTransform};
+
+        std::string extension(const std::string &path)
+        {
+            auto ext = std::filesystem::path(path).extension().string();
+            std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c)
+                           { return static_cast<char>(std::tolower(c)); });
+            return ext;
+        }
+
+        // Shoelace area of a polygon, positive for counter-clockwise
+        template <typename T>
+        double polygonArea(const NDArray<T, 2> &polygon)
+        {
+            const auto n = polygon.shape()[0];
+            double twiceArea = 0.0;
+            for (size_type i = 0; i < n; ++i)
+            {
+                const auto j = (i + 1) % n;
+                twiceArea += static_cast<double>(polygon(i, 0)) * static_cast<double>(polygon(j, 1)) -
+                             static_cast<double>(polygon(j, 0)) * static_cast<double>(polygon(i, 1));
+            }
+            return 0.5 * twiceArea;
+        }
+
+        void writeMoments(std::ostream &out, const std::string &name, const Geometry::Moments &m)
+        {
+            const auto hu = Geometry::huMoments(m);
+            const auto cx = (m.m00 != 0.0) ? m.m10 / m.m00 : 0.0;
+            const auto cy = (m.m00 != 0.0) ? m.m01 / m.m00 : 0.0;
+            out << name << " moments m00=" << m.m00 << " cx=" << cx << " cy=" << cy
+                << " hu1=" << hu[0] << " hu2=" << hu[1] << '\n';
+        }
+
+        // Everything but the moments and the distance transform, which
+        // depend on whether the points came from an image. The hull is
+        // computed by the first stage that needs it and kept in cachedHull.
+        template <typename T>
+        void processPoints(
+            std::ostream &out,
+            const std::string &name,
+            const NDArray<T, 2> &points,
+            std::optional<NDArray<T, 2>> &cachedHull,
+            Stage stage)
+        {
+            const auto convexHull = [&]() -> const NDArray<T, 2> &
+            {
+                if (!cachedHull)
+                    cachedHull = Geometry::computeConvexHull(points);
+                return *cachedHull;
+            };
+
+            switch (stage)
+            {
+            case Stage::Hull:
+            {
+                const auto &hull = convexHull();
+                out << name << " hull vertices=" << hull.shape()[0] << " area=" << polygonArea(hull) << '\n';
+                break;
+            }
+            case Stage::Rectangle:
+            {
+                // The hull of the hull is cheap, only its h vertices are sorted
+                const auto rectangle = Geometry::minAreaRectangle(convexHull());
+                out << name << " rect cx=" << rectangle.center[0] << " cy=" << rectangle.center[1]
+                    << " width=" << rectangle.size[0] << " height=" << rectangle.size[1]
+                    << " angle=" << rectangle.angleDegrees() << '\n';
+                break;
+            }
+            case Stage::Diameter:
+            {
+                const auto &hull = convexHull();
+                const auto pair = Geometry::farthestPair(hull);
+                out << name << " diameter distance=" << pair.distance;
+                if (hull.shape()[0] > 0)
+                {
+                    out << " x1=" << hull(pair.first, 0) << " y1=" << hull(pair.first, 1)
+                        << " x2=" << hull(pair.second, 0) << " y2=" << hull(pair.second, 1);
+                }
+                out << '\n';
+                break;
+            }
+            case Stage::Width:
+            {
+                out << name << " width width=" << Geometry::minimumWidth(convexHull()).width << '\n';
+                break;
+            }
+            case Stage::ClosestPair:
+            {
+                const auto pair = Geometry::closestPair(points);
+                out << name << " closest distance=" << pair.distance
+                    << " first=" << pair.first << " second=" << pair.second << '\n';
+                break;
+            }
+            case Stage::Moments:
+            case Stage::DistanceTransform:
+                break;
+            }
+        }
+
+        // Coordinates of the nonzero pixels, x along columns
+        NDArray<std::int32_t, 2> nonzeroPixels(const NDArray<std::uint8_t, 2> &image)
+        {
+            const auto rows = image.shape()[0];
+            const auto cols = image.shape()[1];
+            const auto count = static_cast<size_type>(std::count_if(image.data(), image.data() + image.size(),
+                                                                    [](std::uint8_t v)
+                                                                    { return v != 0; }));
+
+            auto points = NDArray<std::int32_t, 2>::Empty({count, 2});
+            size_type k = 0;
+            for (size_type y = 0; y < rows; ++y)
+            {
+                for (size_type x = 0; x < cols; ++x)
+                {
+                    if (image(y, x) == 0)
+                        continue;
+                    points(k, 0) = static_cast<std::int32_t>(x);
+                    points(k, 1) = static_cast<std::int32_t>(y);
+                    ++k;
+                }
+            }
+            return points;
+        }
+
+        // Skips whitespace and # comments between PGM header fields
+        bool readPgmField(std::istream &in, size_type &value)
+        {
+            while (in)
+            {
+                const auto c = in.peek();
+                if (c == '#')
+                    in.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                else if (std::isspace(c))
+                    in.get();
+                else
+                    break;
+            }
+            return static_cast<bool>(in >> value);
+        }
+
+        // Whole string as a non-negative integer, no sign or trailing text
+        bool parseCount(const std::string &text, size_type &value)
+        {
+            const auto *last = text.data() + text.size();
+            const auto [next, error] = std::from_chars(text.data(), last, value);
+            return error == std::errc{} && next == last;
+        }
+
+        double percentile(const std::vector<double> &sorted, double p)
+        {
+            if (sorted.empty())
+                return 0.0;
+            const auto rank = static_cast<size_type>(std::ceil(p * static_cast<double>(sorted.size())));
+            return sorted[std::clamp<size_type>(rank, 1, sorted.size()) - 1];
+        }
+
+        // Points or pixels
+        size_type elementCount(const Data &data)
+        {
+            if (const auto *points = std::get_if<NDArray<double, 2>>(&data))
+                return points->shape()[0];
+            return std::get<NDArray<std::uint8_t, 2>>(data).size();
+        }
+
+        void addDirectory(const std::filesystem::path &directory, std::vector<std::string> &inputs)
+        {
+            std::vector<std::string> files;
+            for (const auto &entry : std::filesystem::directory_iterator(directory))
+            {
+                if (entry.is_regular_file())
+                    files.push_back(entry.path().string());
+            }
+            std::sort(files.begin(), files.end());
+            inputs.insert(inputs.end(), files.begin(), files.end());
+        }
+    }
+
+    const char *stageName(Stage stage)
+    {
+        switch (stage)
+        {
+        case Stage::Hull:
+            return "hull";
+        case Stage::Rectangle:
+            return "rect";
+        case Stage::Diameter:
+            return "diameter";
+        case Stage::Width:
+            return "width";
+        case Stage::ClosestPair:
+            return "closest";
+        case Stage::Moments:
+            return "moments";
+        case Stage::DistanceTransform:
+            return "dt";
+        }
+        return "unknown";
+    }
+
+    bool parseStages(const std::string &list, std::vector<Stage> &stages)
+    {
+        stages.clear();
+        std::istringstream in(list);
+        std::string name;
+        while (std::getline(in, name, ','))
+        {
+            if (name == "all")
+            {
+                stages.insert(stages.end(), std::begin(AllStages), std::end(AllStages));
+                continue;
+            }
+
+            const auto it = std::find_if(std::begin(AllStages), std::end(AllStages), [&name](Stage stage)
+                                         { return name == stageName(stage); });
+            if (it == std::end(AllStages))
+                return false;
+            stages.push_back(*it);
+        }
+        return !stages.empty();
+    }
+
+    bool parseOptions(int argc, char **argv, Options &options)
+    {
+        const auto usage = []()
+        {
+            std::cerr << "usage: batch [--stages hull,rect,diameter,width,closest,moments,dt|all]"
+                      << " [--threads n] [--repeat n] [--output path] [--quiet] inputs..." << std::endl
+                      << "inputs are files or directories of .txt/.csv/.xy points, .bin float64 points,"
+                      << " .pgm images or .npy arrays" << std::endl;
+            return false;
+        };
+
+        if (options.stages.empty())
+            parseStages("hull,rect", options.stages);
+
+        for (int i = 0; i < argc; ++i)
+        {
+            const std::string arg = argv[i];
+            if (arg == "--help" || arg == "-h")
+                return usage();
+
+            if (arg == "--quiet")
+            {
+                options.quiet = true;
+                continue;
+            }
+
+            if (arg.starts_with("--"))
+            {
+                if (i + 1 >= argc)
+                    return usage();
+
+                const std::string value = argv[++i];
+                if (arg == "--stages")
+                {
+                    if (!parseStages(value, options.stages))
+                        return usage();
+                }
+                else if (arg == "--threads")
+                {
+                    if (!parseCount(value, options.threads))
+                        return usage();
+                }
+                else if (arg == "--repeat")
+                {
+                    if (!parseCount(value, options.repeat) || options.repeat == 0)
+                        return usage();
+                }
+                else if (arg == "--output")
+                    options.outputPath = value;
+                else
+                    return usage();
+                continue;
+            }
+
+            if (std::filesystem::is_directory(arg))
+                addDirectory(arg, options.inputs);
+            else
+                options.inputs.push_back(arg);
+        }
+
+        if (options.inputs.empty())
+            return usage();
+        return true;
+    }
+
+    std::optional<NDArray<double, 2>> readTextPoints(std::istream &in)
+    {
+        std::vector<double> values;
+        std::string line;
+        while (std::getline(in, line))
+        {
+            line = line.substr(0, line.find('#'));
+            std::replace(line.begin(), line.end(), ',', ' ');
+
+            const char *first = line.data();
+            const char *last = line.data() + line.size();
+            size_type count = 0;
+            while (true)
+            {
+                while (first != last && std::isspace(static_cast<unsigned char>(*first)))
+                    ++first;
+                if (first == last)
+                    break;
+
+                double value = 0.0;
+                const auto [next, error] = std::from_chars(first, last, value);
+                if (error != std::errc{})
+                    return std::nullopt;
+                values.push_back(value);
+                first = next;
+                ++count;
+            }
+
+            if (count != 0 && count != 2)
+                return std::nullopt;
+        }
+
+        auto points = NDArray<double, 2>::Empty({values.size() / 2, 2});
+        std::copy(values.begin(), values.end(), points.data());
+        return points;
+    }
+
+    std::optional<NDArray<double, 2>> readBinaryPoints(std::istream &in)
+    {
+        const std::string bytes{std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+        if (bytes.size() % (2 * sizeof(double)) != 0)
+            return std::nullopt;
+
+        auto points = NDArray<double, 2>::Empty({bytes.size() / (2 * sizeof(double)), 2});
+        std::copy(bytes.begin(), bytes.end(), reinterpret_cast<char *>(points.data()));
+        return points;
+    }
+
+    std::optional<NDArray<std::uint8_t, 2>> readPgm(std::istream &in)
+    {
+        char magic[2] = {};
+        if (!in.read(magic, 2) || magic[0] != 'P' || (magic[1] != '5' && magic[1] != '2'))
+            return std::nullopt;
+
+        size_type width = 0, height = 0, maxValue = 0;
+        if (!readPgmField(in, width) || !readPgmField(in, height) || !readPgmField(in, maxValue) ||
+            maxValue == 0 || maxValue > 255)
+            return std::nullopt;
+
+        // Every pixel takes at least one byte, binary or ASCII, so a header
+        // promising more than the stream holds is rejected before allocating
+        const auto remaining = ND::Detail::remainingBytes(in);
+        if (width != 0 && (height > std::numeric_limits<size_type>::max() / width || height * width > remaining))
+            return std::nullopt;
+
+        auto image = NDArray<std::uint8_t, 2>::Empty({height, width});
+        if (magic[1] == '5')
+        {
+            // Exactly one whitespace character separates header and pixels
+            in.get();
+            if (!in.read(reinterpret_cast<char *>(image.data()), static_cast<std::streamsize>(image.size())))
+                return std::nullopt;
+            return image;
+        }
+
+        for (size_type i = 0; i < image.size(); ++i)
+        {
+            size_type value = 0;
+            if (!readPgmField(in, value) || value > maxValue)
+                return std::nullopt;
+            image[i] = static_cast<std::uint8_t>(value);
+        }
+        return image;
+    }
+
+    std::optional<Data> readNpyData(std::istream &in)
+    {
+        const auto array = ND::readNpy(in);
+        if (!array || array->ndim() != 2)
+            return std::nullopt;
+
+        if (array->dtype() == ND::DType::UInt8)
+            return array->as<std::uint8_t, 2>();
+        if (array->shape()[1] != 2)
+            return std::nullopt;
+        if (array->dtype() == ND::DType::Float64)
+            return array->as<double, 2>();
+        return array->AsType(ND::DType::Float64).as<double, 2>();
+    }
+
+    std::optional<Data> load(const std::string &path, const ImageLoader &imageLoader)
+    {
+        const auto ext = extension(path);
+        const auto binary = (ext == ".bin" || ext == ".pgm" || ext == ".npy");
+        std::ifstream file(path, binary ? std::ios::binary : std::ios::in);
+        if (!file)
+            return std::nullopt;
+
+        if (ext == ".txt" || ext == ".csv" || ext == ".xy")
+            return readTextPoints(file);
+        if (ext == ".bin")
+            return readBinaryPoints(file);
+        if (ext == ".pgm")
+            return readPgm(file);
+        if (ext == ".npy")
+            return readNpyData(file);
+
+        if (imageLoader)
+        {
+            auto image = NDArray<std::uint8_t, 2>::Empty({0, 0});
+            if (imageLoader(path, image))
+                return image;
+        }
+        return std::nullopt;
+    }
+
+    std::string process(const std::string &name, const Data &data, const std::vector<Stage> &stages)
+    {
+        TRACE_SCOPE("batch.process");
+        std::ostringstream out;
+        out << std::setprecision(10);
+
+        if (const auto *points = std::get_if<NDArray<double, 2>>(&data))
+        {
+            std::optional<NDArray<double, 2>> hull;
+            for (const auto stage : stages)
+            {
+                if (stage == Stage::Moments)
+                    writeMoments(out, name, Geometry::pointMoments(*points));
+                else
+                    processPoints(out, name, *points, hull, stage);
+            }
+            return out.str();
+        }
+
+        const auto &image = std::get<NDArray<std::uint8_t, 2>>(data);
+        std::optional<NDArray<std::int32_t, 2>> pixels;
+        std::optional<NDArray<std::int32_t, 2>> hull;
+        for (const auto stage : stages)
+        {
+            if (stage == Stage::Moments)
+            {
+                writeMoments(out, name, Geometry::imageMoments(image));
+            }
+            else if (stage == Stage::DistanceTransform)
+            {
+                const auto distances = Geometry::distanceTransform(image);
+                const auto *begin = distances.data();
+                const auto largest = (distances.size() > 0) ? *std::max_element(begin, begin + distances.size()) : 0.0f;
+                out << name << " dt max=" << largest << '\n';
+            }
+            else
+            {
+                if (!pixels)
+                    pixels = nonzeroPixels(image);
+                processPoints(out, name, *pixels, hull, stage);
+            }
+        }
+        return out.str();
+    }
+
+    std::ostream &operator<<(std::ostream &out, const Statistics &s)
+    {
+        const auto flags = out.flags();
+        const auto precision = out.precision();
+        out << std::fixed << std::setprecision(3)
+            << s.inputs << " inputs (" << s.failures << " failed), " << s.elements << " elements in "
+            << s.seconds << " s\n"
+            << "throughput " << static_cast<double>(s.inputs) / std::max(s.seconds, 1e-9) << " inputs/s, "
+            << static_cast<double>(s.elements) / std::max(s.seconds, 1e-9) / 1e6 << " M elements/s\n"
+            << "latency mean " << 1e3 * s.meanLatency << " ms, p50 " << 1e3 * s.p50Latency
+            << " ms, p90 " << 1e3 * s.p90Latency << " ms, p99 " << 1e3 * s.p99Latency
+            << " ms, max " << 1e3 * s.maxLatency << " ms";
+        out.flags(flags);
+        out.precision(precision);
+        return out;
+    }
+
+    Statistics run(const Options &options)
+    {
+        const auto n = options.inputs.size();
+        const auto items = n * options.repeat;
+        const auto threads = std::clamp<size_type>((options.threads == 0) ? Parallel::hardwareThreads() : options.threads,
+                                                   1, std::max<size_type>(items, 1));
+
+        // Only the first pass keeps its results, repeats are for timing
+        std::vector<std::string> results(n);
+        std::vector<double> latencies(items);
+        std::atomic<size_type> next{0};
+        std::atomic<size_type> failures{0};
+        std::atomic<size_type> elements{0};
+
+        // Opened up front, so a bad path fails before the work is done
+        std::ofstream file;
+        if (!options.quiet && !options.outputPath.empty())
+        {
+            file.open(options.outputPath);
+            if (!file.is_open())
+            {
+                std::cerr << "batch: cannot open " << options.outputPath << " for writing" << std::endl;
+                Statistics statistics{};
+                statistics.outputFailed = true;
+                return statistics;
+            }
+        }
+
+        const auto worker = [&]()
+        {
+            for (auto item = next.fetch_add(1); item < items; item = next.fetch_add(1))
+            {
+                const auto i = item % n;
+                const auto start = std::chrono::steady_clock::now();
+
+                // One bad input, e.g. too large to allocate, only fails itself
+                std::string lines;
+                bool failed = false;
+                try
+                {
+                    auto data = load(options.inputs[i], options.imageLoader);
+                    if (data)
+                    {
+                        lines = process(options.inputs[i], *data, options.stages);
+                        elements.fetch_add(elementCount(*data), std::memory_order_relaxed);
+                    }
+                    else
+                    {
+                        lines = options.inputs[i] + " error could not read input\n";
+                        failed = true;
+                    }
+                }
+                catch (const std::exception &e)
+                {
+                    lines = options.inputs[i] + " error " + e.what() + "\n";
+                    failed = true;
+                }
+
+                if (failed)
+                    failures.fetch_add(1, std::memory_order_relaxed);
+
+                latencies[item] = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                if (item < n)
+                    results[i] = std::move(lines);
+            }
+        };
+
+        const auto start = std::chrono::steady_clock::now();
+        {
+            std::vector<std::jthread> workers;
+            for (size_type t = 1; t < threads; ++t)
+                workers.emplace_back(worker);
+            worker();
+        }
+        const auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        Statistics statistics{};
+        if (!options.quiet)
+        {
+            auto &out = options.outputPath.empty() ? std::cout : file;
+            for (const auto &lines : results)
+                out << lines;
+            if (!out.flush())
+            {
+                std::cerr << "batch: writing the results failed" << std::endl;
+                statistics.outputFailed = true;
+            }
+        }
+
+        statistics.inputs = items;
+        statistics.failures = failures.load();
+        statistics.elements = elements.load();
+        statistics.seconds = seconds;
+
+        std::sort(latencies.begin(), latencies.end());
+        if (!latencies.empty())
+        {
+            statistics.meanLatency = std::accumulate(latencies.begin(), latencies.end(), 0.0) /
+                                     static_cast<double>(latencies.size());
+            statistics.maxLatency = latencies.back();
+        }
+        statistics.p50Latency = percentile(latencies, 0.50);
+        statistics.p90Latency = percentile(latencies, 0.90);
+        statistics.p99Latency = percentile(latencies, 0.99);
+        return statistics;
+    }
+
+    int main(int argc, char **argv, ImageLoader imageLoader)
+    {
+        Options options{};
+        options.imageLoader = std::move(imageLoader);
+        if (!parseOptions(argc, argv, options))
+            return 2;
+
+        const auto statistics = run(options);
+        if (statistics.inputs != 0)
+            std::cerr << statistics << std::endl;
+        return (statistics.failures == 0 && !statistics.outputFailed) ? 0 : 1;
+    }
+
+    /**************************************************************************/
+
+    void testBatch()
+    {
+        std::cout << "Running tests for the batch driver..." << std::endl;
+
+        std::vector<Stage> stages;
+        DEBUG_ONLY const auto parsed = parseStages("hull,rect,moments", stages);
+        assert(parsed && stages.size() == 3 && stages[1] == Stage::Rectangle && "Stage list not parsed");
+        assert(!parseStages("hull,bogus", stages) && "Unknown stage accepted");
+        DEBUG_ONLY const auto all = parseStages("all", stages);
+        assert(all && stages.size() == std::size(AllStages) && "all not expanded");
+
+        std::istringstream text("# square\n0 0\n4,0\n\n4 4 # corner\n0 4\n2 2\n");
+        DEBUG_ONLY const auto points = readTextPoints(text);
+        assert(points && points->shape()[0] == 5 && (*points)(1, 0) == 4.0 && (*points)(3, 1) == 4.0 &&
+               "Text points not parsed");
+        std::istringstream badText("0 0\n1 2 3\n");
+        assert(!readTextPoints(badText) && "Odd value count accepted");
+
+        const double raw[] = {1.0, 2.0, 3.0, 4.0};
+        std::istringstream binary(std::string(reinterpret_cast<const char *>(raw), sizeof(raw)));
+        DEBUG_ONLY const auto binaryPoints = readBinaryPoints(binary);
+        assert(binaryPoints && binaryPoints->shape()[0] == 2 && (*binaryPoints)(1, 1) == 4.0 &&
+               "Binary points not parsed");
+
+        std::istringstream ascii("P2\n# comment\n3 2\n255\n0 0 0\n0 9 0\n");
+        DEBUG_ONLY const auto image = readPgm(ascii);
+        assert(image && image->shape()[0] == 2 && image->shape()[1] == 3 && (*image)(1, 1) == 9 &&
+               "ASCII PGM not parsed");
+        std::istringstream raster(std::string("P5 2 1 255\n") + std::string("\x00\x07", 2));
+        DEBUG_ONLY const auto rasterImage = readPgm(raster);
+        assert(rasterImage && (*rasterImage)(0, 1) == 7 && "Binary PGM not parsed");
+        std::istringstream hugeRaster("P5 100000 100000 255\n");
+        assert(!readPgm(hugeRaster) && "PGM larger than its data allocated");
+        std::istringstream shortAscii("P2 3 2 255\n0 0 0\n");
+        assert(!readPgm(shortAscii) && "Truncated ASCII PGM accepted");
+
+        // .npy points of any dtype become float64, uint8 arrays images
+        auto shortPoints = ND::DynArray::Zeros(ND::DType::Int16, {3, 2});
+        shortPoints.data<std::int16_t>()[5] = -7;
+        std::stringstream npyPoints;
+        ND::writeNpy(npyPoints, shortPoints);
+        DEBUG_ONLY const auto npyData = readNpyData(npyPoints);
+        assert((npyData && std::get<NDArray<double, 2>>(*npyData)(2, 1) == -7.0) && ".npy points not read");
+        std::stringstream npyImage;
+        ND::writeNpy(npyImage, ND::DynArray(*rasterImage));
+        DEBUG_ONLY const auto npyImageData = readNpyData(npyImage);
+        assert((npyImageData && std::get<NDArray<std::uint8_t, 2>>(*npyImageData)(0, 1) == 7) && ".npy image not read");
+
+        // Counts must be whole non-negative numbers
+        DEBUG_ONLY const auto parses = [](std::vector<std::string> args)
+        {
+            std::vector<char *> argv;
+            for (auto &arg : args)
+                argv.push_back(arg.data());
+            Options parsed{};
+            return parseOptions(static_cast<int>(argv.size()), argv.data(), parsed) && parsed.threads == 3;
+        };
+        assert(parses({"--threads", "3", "in.txt"}) && "Thread count rejected");
+        assert(!parses({"--threads", "abc", "in.txt"}) && !parses({"--threads", "-1", "in.txt"}) &&
+               !parses({"--threads", "3x", "in.txt"}) && !parses({"--repeat", "0", "in.txt"}) && "Bad count accepted");
+
+        parseStages("all", stages);
+        DEBUG_ONLY const auto pointLines = process("square", Data{*points}, stages);
+        assert(pointLines.find("square hull vertices=4 area=16\n") != std::string::npos && "Wrong hull");
+        assert(pointLines.find("square width width=4\n") != std::string::npos && "Wrong width");
+        assert(pointLines.find(" dt ") == std::string::npos && "Image stage ran on points");
+
+        DEBUG_ONLY const auto imageLines = process("image", Data{*image}, stages);
+        assert(imageLines.find("image hull vertices=1 area=0\n") != std::string::npos && "Wrong pixel hull");
+        assert(imageLines.find("image dt max=1\n") != std::string::npos && "Wrong distance transform");
+
+        // End to end through files, results stay in input order
+        const auto directory = std::filesystem::temp_directory_path() /
+                               ("cpp_eigen_opencv_batch_" + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id())));
+        std::filesystem::create_directories(directory);
+        std::vector<std::string> inputs;
+        for (int i = 0; i < 16; ++i)
+        {
+            const auto path = directory / ("points" + std::to_string(i) + ".txt");
+            std::ofstream(path) << "0 0\n"
+                                << i + 1 << " 0\n0 1\n";
+            inputs.push_back(path.string());
+        }
+        inputs.push_back((directory / "missing.txt").string());
+
+        Options options{};
+        parseStages("hull", options.stages);
+        options.inputs = inputs;
+        options.threads = 4;
+        options.repeat = 3;
+        options.outputPath = (directory / "results.txt").string();
+        DEBUG_ONLY const auto statistics = run(options);
+        assert(statistics.inputs == 3 * inputs.size() && statistics.failures == 3 && "Wrong input counts");
+        assert(statistics.elements == 3 * 16 * 3 && "Wrong element count");
+        assert(statistics.p50Latency <= statistics.p99Latency && statistics.p99Latency <= statistics.maxLatency &&
+               "Latency percentiles out of order");
+
+        std::ifstream resultFile(options.outputPath);
+        std::vector<std::string> lines;
+        for (std::string line; std::getline(resultFile, line);)
+            lines.push_back(line);
+        assert(lines.size() == inputs.size() && "One line per input expected");
+        for (size_type i = 0; i < 16; ++i)
+        {
+            DEBUG_ONLY const auto expected = inputs[i] + " hull vertices=3 area=" +
+                                             (i % 2 == 0 ? std::to_string(i / 2) + ".5" : std::to_string((i + 1) / 2));
+            assert(lines[i] == expected && "Results out of order");
+        }
+        assert(lines.back() == inputs.back() + " error could not read input" && "Missing input not reported");
+
+        // An output file that cannot be opened fails the run
+        options.outputPath = (directory / "missing" / "results.txt").string();
+        assert(run(options).outputFailed && "Unwritable output not reported");
+
+        std::filesystem::remove_all(directory);
+    }
+
+} // namespace Batch
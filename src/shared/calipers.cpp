@@ -0,0 +1,104 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Sparsh Jain
+ *
+ */
+
+#include <iostream>
+#include <random>
+
+#include <cpp_eigen_opencv/shared/ndarray.hpp>
+#include <cpp_eigen_opencv/shared/geometry.hpp>
+#include <cpp_eigen_opencv/shared/calipers.hpp>
+#include <cpp_eigen_opencv/shared/debug.hpp>
+
+namespace Geometry
+{
+    namespace
+    {
+        void testCalipersInvariants(const NDArray<double, 2> &points)
+        {
+            const auto N = points.shape()[0];
+            const auto hull = computeConvexHull(points);
+            const auto h = hull.shape()[0];
+
+            DEBUG_ONLY constexpr double eps = 1e-6;
+            const auto distance = [](const NDArray<double, 2> &p, size_type a, size_type b)
+            {
+                const double dx = p(a, 0) - p(b, 0);
+                const double dy = p(a, 1) - p(b, 1);
+                return std::sqrt(dx * dx + dy * dy);
+            };
+
+            // Diameter matches the brute force farthest pair of hull vertices
+            DEBUG_ONLY const auto diameter = farthestPair(hull);
+            double expectedDiameter = 0.0;
+            for (size_type i = 0; i < h; ++i)
+            {
+                for (size_type j = i + 1; j < h; ++j)
+                    expectedDiameter = std::max(expectedDiameter, distance(hull, i, j));
+            }
+            assert(std::abs(diameter.distance - expectedDiameter) <= eps &&
+                   "Diameter mismatch");
+            assert(std::abs(distance(hull, diameter.first, diameter.second) - diameter.distance) <= eps &&
+                   "Diameter pair does not match its distance");
+
+            // Width matches the brute force minimum over edges of the
+            // largest distance of any hull vertex from that edge
+            if (h >= 3)
+            {
+                DEBUG_ONLY const auto width = minimumWidth(hull);
+                double expectedWidth = std::numeric_limits<double>::infinity();
+                for (size_type i = 0; i < h; ++i)
+                {
+                    const auto next = (i + 1) % h;
+                    const double length = distance(hull, i, next);
+                    double farthest = 0.0;
+                    for (size_type j = 0; j < h; ++j)
+                        farthest = std::max(farthest, Detail::doubleArea(hull, i, next, j) / length);
+                    expectedWidth = std::min(expectedWidth, farthest);
+                }
+                assert(std::abs(width.width - expectedWidth) <= eps && "Width mismatch");
+            }
+
+            // Closest pair matches brute force
+            DEBUG_ONLY const auto closest = closestPair(points);
+            double expectedClosest = std::numeric_limits<double>::infinity();
+            for (size_type i = 0; i < N; ++i)
+            {
+                for (size_type j = i + 1; j < N; ++j)
+                    expectedClosest = std::min(expectedClosest, distance(points, i, j));
+            }
+            assert(closest.distance == expectedClosest && "Closest pair mismatch");
+            assert((N < 2 || (closest.first < closest.second &&
+                              distance(points, closest.first, closest.second) == closest.distance)) &&
+                   "Closest pair does not match its distance");
+        }
+    }
+
+    void testCalipers()
+    {
+        std::cout << "Running tests for rotating calipers and closestPair..." << std::endl;
+
+        std::mt19937 rng(54); // Fixed seed for reproducibility
+        std::uniform_real_distribution<double> dist(-1000.0, 1000.0);
+        std::uniform_int_distribution<int> grid(-20, 20);
+
+        for (int iter = 0; iter < 500; ++iter)
+        {
+            const size_type numPoints = rng() % 500 + 1;
+            auto points = NDArray<double, 2>::Empty({numPoints, 2});
+
+            for (size_type i = 0; i < numPoints; ++i)
+            {
+                // Every other set on a small grid to get duplicates and ties
+                points(i, 0) = (iter % 2 == 0) ? dist(rng) : grid(rng);
+                points(i, 1) = (iter % 2 == 0) ? dist(rng) : grid(rng);
+            }
+
+            testCalipersInvariants(points);
+        }
+    }
+
+} // namespace Geometry
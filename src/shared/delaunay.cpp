@@ -0,0 +1,666 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Sparsh Jain
+ *
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <set>
+#include <utility>
+
+#include <cpp_eigen_opencv/shared/ndarray.hpp>
+#include <cpp_eigen_opencv/shared/geometry.hpp>
+#include <cpp_eigen_opencv/shared/predicates.hpp>
+#include <cpp_eigen_opencv/shared/delaunay.hpp>
+#include <cpp_eigen_opencv/shared/debug.hpp>
+
+namespace Geometry
+{
+    namespace
+    {
+        constexpr size_type None = DelaunayTriangulation::NoHalfedge;
+
+        // Position of (x, y) along a Hilbert curve over a 2^16 x 2^16 grid
+        std::uint64_t hilbertIndex(std::uint32_t x, std::uint32_t y)
+        {
+            constexpr std::uint32_t n = 1u << 16;
+
+            std::uint64_t d = 0;
+            for (std::uint32_t s = n / 2; s > 0; s /= 2)
+            {
+                const std::uint32_t rx = ((x & s) > 0) ? 1u : 0u;
+                const std::uint32_t ry = ((y & s) > 0) ? 1u : 0u;
+                d += static_cast<std::uint64_t>(s) * s * ((3u * rx) ^ ry);
+
+                // Rotate the quadrant so the curve stays continuous
+                if (ry == 0)
+                {
+                    if (rx == 1)
+                    {
+                        x = n - 1 - x;
+                        y = n - 1 - y;
+                    }
+                    std::swap(x, y);
+                }
+            }
+
+            return d;
+        }
+
+        // Indices of the first N points sorted along a Hilbert curve
+        // over their bounding box, so consecutive points are close
+        std::vector<size_type> hilbertOrder(const NDArray<double, 2> &points, size_type N)
+        {
+            std::vector<size_type> order(N);
+            std::iota(order.begin(), order.end(), 0);
+            if (N == 0)
+                return order;
+
+            double minX = points(0, 0), maxX = points(0, 0);
+            double minY = points(0, 1), maxY = points(0, 1);
+            for (size_type i = 1; i < N; ++i)
+            {
+                minX = std::min(minX, points(i, 0));
+                maxX = std::max(maxX, points(i, 0));
+                minY = std::min(minY, points(i, 1));
+                maxY = std::max(maxY, points(i, 1));
+            }
+
+            const double scaleX = (maxX > minX) ? 65535.0 / (maxX - minX) : 0.0;
+            const double scaleY = (maxY > minY) ? 65535.0 / (maxY - minY) : 0.0;
+
+            std::vector<std::uint64_t> keys(N);
+            for (size_type i = 0; i < N; ++i)
+            {
+                keys[i] = hilbertIndex(
+                    static_cast<std::uint32_t>((points(i, 0) - minX) * scaleX),
+                    static_cast<std::uint32_t>((points(i, 1) - minY) * scaleY));
+            }
+
+            std::stable_sort(order.begin(), order.end(), [&keys](size_type a, size_type b)
+                             { return keys[a] < keys[b]; });
+            return order;
+        }
+
+        // Incremental Bowyer-Watson triangulation
+        // The outside of the hull is covered by ghost triangles sharing the
+        // infinite vertex, so every triangle always has three neighbors and
+        // points outside the hull are inserted exactly like inner points.
+        class Triangulator final
+        {
+        private:
+            const NDArray<double, 2> &m_points;
+            const size_type m_infinite;
+
+            std::vector<size_type> m_vertex{};       // per half-edge
+            std::vector<size_type> m_twin{};         // per half-edge
+            std::vector<std::uint8_t> m_alive{};     // per triangle
+            std::vector<size_type> m_inCavity{};     // per triangle, insertion stamp
+            std::vector<size_type> m_rejected{};     // per triangle, insertion stamp
+            std::vector<size_type> m_free{};         // reusable triangle slots
+            std::vector<size_type> m_startOf{};      // per vertex, new triangle
+            std::vector<size_type> m_stack{};        // cavity search
+            std::vector<size_type> m_newTriangles{}; // created by one insertion
+
+            struct BoundaryEdge
+            {
+                size_type from;
+                size_type to;
+                size_type outside; // half-edge across the cavity boundary
+            };
+            std::vector<BoundaryEdge> m_boundary{};
+
+            size_type m_last{0};
+            std::uint32_t m_walkState{0x9e3779b9u};
+
+            inline double x(size_type v) const { return m_points(v, 0); }
+
+            inline double y(size_type v) const { return m_points(v, 1); }
+
+            inline double orient(size_type a, size_type b, size_type c) const
+            {
+                return orient2d(x(a), y(a), x(b), y(b), x(c), y(c));
+            }
+
+            inline bool isGhost(size_type t) const
+            {
+                return m_vertex[3 * t] == m_infinite ||
+                       m_vertex[3 * t + 1] == m_infinite ||
+                       m_vertex[3 * t + 2] == m_infinite;
+            }
+
+            // Half-edge of ghost triangle t that does not touch the infinite vertex
+            inline size_type finiteHalfedge(size_type t) const
+            {
+                for (size_type k = 0; k < 3; ++k)
+                {
+                    const auto e = 3 * t + k;
+                    if (m_vertex[e] != m_infinite &&
+                        m_vertex[DelaunayTriangulation::nextHalfedge(e)] != m_infinite)
+                        return e;
+                }
+                assert(false && "Triangle has no finite edge");
+                return None;
+            }
+
+            inline void link(size_type e, size_type f)
+            {
+                m_twin[e] = f;
+                m_twin[f] = e;
+            }
+
+            size_type newTriangle(size_type a, size_type b, size_type c)
+            {
+                size_type t;
+                if (!m_free.empty())
+                {
+                    t = m_free.back();
+                    m_free.pop_back();
+                }
+                else
+                {
+                    t = m_alive.size();
+                    m_vertex.resize(3 * t + 3);
+                    m_twin.resize(3 * t + 3);
+                    m_alive.push_back(0);
+                    m_inCavity.push_back(0);
+                    m_rejected.push_back(0);
+                }
+
+                m_vertex[3 * t] = a;
+                m_vertex[3 * t + 1] = b;
+                m_vertex[3 * t + 2] = c;
+                m_twin[3 * t] = m_twin[3 * t + 1] = m_twin[3 * t + 2] = None;
+                m_alive[t] = 1;
+                m_inCavity[t] = 0;
+                m_rejected[t] = 0;
+                return t;
+            }
+
+            // Whether p lies inside the circumcircle of triangle t
+            // For a ghost triangle the circumcircle degenerates to the open
+            // half-plane outside its hull edge plus the open edge itself
+            bool conflicts(size_type t, size_type p) const
+            {
+                if (!isGhost(t))
+                {
+                    const auto a = m_vertex[3 * t];
+                    const auto b = m_vertex[3 * t + 1];
+                    const auto c = m_vertex[3 * t + 2];
+                    return incircle(x(a), y(a), x(b), y(b), x(c), y(c), x(p), y(p)) > 0.0;
+                }
+
+                const auto e = finiteHalfedge(t);
+                const auto a = m_vertex[e];
+                const auto b = m_vertex[DelaunayTriangulation::nextHalfedge(e)];
+                const auto o = orient(a, b, p);
+                if (o != 0.0)
+                    return o > 0.0;
+
+                // Collinear, compare along the dominant coordinate exactly
+                if (x(a) != x(b))
+                    return std::min(x(a), x(b)) < x(p) && x(p) < std::max(x(a), x(b));
+                return std::min(y(a), y(b)) < y(p) && y(p) < std::max(y(a), y(b));
+            }
+
+            // Visibility walk from the last created triangle
+            // Returns a triangle in conflict with p, or None if p duplicates a vertex
+            size_type locate(size_type p)
+            {
+                auto t = m_last;
+                if (isGhost(t))
+                    t = m_twin[finiteHalfedge(t)] / 3;
+
+                while (true)
+                {
+                    if (isGhost(t))
+                        return t;
+
+                    // Randomized edge order guarantees termination
+                    m_walkState ^= m_walkState << 13;
+                    m_walkState ^= m_walkState >> 17;
+                    m_walkState ^= m_walkState << 5;
+                    const auto offset = static_cast<size_type>(m_walkState % 3);
+
+                    bool moved = false;
+                    for (size_type k = 0; k < 3 && !moved; ++k)
+                    {
+                        const auto e = 3 * t + (k + offset) % 3;
+                        if (orient(m_vertex[e], m_vertex[DelaunayTriangulation::nextHalfedge(e)], p) < 0.0)
+                        {
+                            t = m_twin[e] / 3;
+                            moved = true;
+                        }
+                    }
+
+                    if (!moved)
+                        break;
+                }
+
+                for (size_type k = 0; k < 3; ++k)
+                {
+                    const auto v = m_vertex[3 * t + k];
+                    if (x(v) == x(p) && y(v) == y(p))
+                        return None;
+                }
+
+                return t;
+            }
+
+            void insert(size_type p)
+            {
+                const auto seed = locate(p);
+                if (seed == None)
+                    return;
+
+                // Grow the cavity of triangles whose circumcircle contains p
+                const auto stamp = p + 1;
+                m_boundary.clear();
+                m_stack.clear();
+                m_stack.push_back(seed);
+                m_inCavity[seed] = stamp;
+
+                while (!m_stack.empty())
+                {
+                    const auto t = m_stack.back();
+                    m_stack.pop_back();
+
+                    for (size_type k = 0; k < 3; ++k)
+                    {
+                        const auto e = 3 * t + k;
+                        const auto neighbor = m_twin[e] / 3;
+                        if (m_inCavity[neighbor] == stamp)
+                            continue;
+
+                        if (m_rejected[neighbor] != stamp && conflicts(neighbor, p))
+                        {
+                            m_inCavity[neighbor] = stamp;
+                            m_stack.push_back(neighbor);
+                        }
+                        else
+                        {
+                            m_rejected[neighbor] = stamp;
+                            m_boundary.push_back({m_vertex[e],
+                                                  m_vertex[DelaunayTriangulation::nextHalfedge(e)],
+                                                  m_twin[e]});
+                        }
+                    }
+
+                    m_alive[t] = 0;
+                    m_free.push_back(t);
+                }
+
+                // The cavity is star-shaped from p, connect p to its boundary
+                m_newTriangles.clear();
+                for (const auto &edge : m_boundary)
+                {
+                    const auto t = newTriangle(edge.from, edge.to, p);
+                    link(3 * t, edge.outside);
+                    m_startOf[edge.from] = t;
+                    m_newTriangles.push_back(t);
+                }
+
+                for (const auto t : m_newTriangles)
+                {
+                    const auto next = m_startOf[m_vertex[3 * t + 1]];
+                    link(3 * t + 1, 3 * next + 2);
+                    if (!isGhost(t))
+                        m_last = t;
+                }
+            }
+
+        public:
+            explicit Triangulator(const NDArray<double, 2> &points, size_type N)
+                : m_points(points),
+                  m_infinite(N),
+                  m_startOf(N + 1, None)
+            {
+                m_vertex.reserve(6 * N + 12);
+                m_twin.reserve(6 * N + 12);
+            }
+
+            DelaunayTriangulation run()
+            {
+                const auto N = m_infinite;
+                DelaunayTriangulation result{};
+                if (N == 0)
+                    return result;
+
+                const auto order = hilbertOrder(m_points, N);
+                const auto same = [this](size_type a, size_type b)
+                { return x(a) == x(b) && y(a) == y(b); };
+                const auto lexLess = [this](size_type a, size_type b)
+                { return x(a) < x(b) || (x(a) == x(b) && y(a) < y(b)); };
+
+                // Find a first non-degenerate triangle
+                const auto a = order[0];
+                size_type b = None;
+                size_type c = None;
+                for (const auto i : order)
+                {
+                    if (b == None && !same(a, i))
+                        b = i;
+                    else if (b != None && orient(a, b, i) != 0.0)
+                    {
+                        c = i;
+                        break;
+                    }
+                }
+
+                if (c == None)
+                {
+                    // All points collinear or equal, the hull is the two extremes
+                    const auto [lo, hi] = std::minmax_element(order.begin(), order.end(), lexLess);
+                    result.hull.push_back(*lo);
+                    if (!same(*lo, *hi))
+                        result.hull.push_back(*hi);
+                    return result;
+                }
+
+                if (orient(a, b, c) < 0.0)
+                    std::swap(b, c);
+
+                const auto t0 = newTriangle(a, b, c);
+                const auto gab = newTriangle(b, a, m_infinite);
+                const auto gbc = newTriangle(c, b, m_infinite);
+                const auto gca = newTriangle(a, c, m_infinite);
+                link(3 * t0, 3 * gab);
+                link(3 * t0 + 1, 3 * gbc);
+                link(3 * t0 + 2, 3 * gca);
+                link(3 * gab + 1, 3 * gca + 2);
+                link(3 * gbc + 1, 3 * gab + 2);
+                link(3 * gca + 1, 3 * gbc + 2);
+                m_last = t0;
+
+                for (const auto p : order)
+                {
+                    if (p != a && p != b && p != c)
+                        insert(p);
+                }
+
+                // Compact the finite triangles and drop the ghosts
+                std::vector<size_type> compact(m_alive.size(), None);
+                size_type count = 0;
+                for (size_type t = 0; t < m_alive.size(); ++t)
+                {
+                    if (m_alive[t] && !isGhost(t))
+                        compact[t] = count++;
+                }
+
+                result.triangles.resize(3 * count);
+                result.halfedges.resize(3 * count);
+                std::vector<size_type> hullNext(N, None);
+                for (size_type t = 0; t < m_alive.size(); ++t)
+                {
+                    if (!m_alive[t])
+                        continue;
+
+                    if (isGhost(t))
+                    {
+                        // Ghost (u, v, inf) sits outside the hull edge v -> u
+                        const auto e = finiteHalfedge(t);
+                        hullNext[m_vertex[DelaunayTriangulation::nextHalfedge(e)]] = m_vertex[e];
+                        continue;
+                    }
+
+                    for (size_type k = 0; k < 3; ++k)
+                    {
+                        const auto e = 3 * t + k;
+                        const auto twin = m_twin[e];
+                        result.triangles[3 * compact[t] + k] = m_vertex[e];
+                        result.halfedges[3 * compact[t] + k] =
+                            (compact[twin / 3] == None) ? None : 3 * compact[twin / 3] + twin % 3;
+                    }
+                }
+
+                size_type start = None;
+                for (size_type v = 0; v < N; ++v)
+                {
+                    if (hullNext[v] != None && (start == None || lexLess(v, start)))
+                        start = v;
+                }
+
+                auto v = start;
+                do
+                {
+                    result.hull.push_back(v);
+                    v = hullNext[v];
+                } while (v != start);
+
+                return result;
+            }
+        };
+    }
+
+    DelaunayTriangulation delaunayTriangulation(
+        const NDArray<double, 2> &points,
+        const int count)
+    {
+        const auto N = (count < 0) ? points.shape()[0] : static_cast<size_type>(count);
+        assert(N <= points.shape()[0]);
+        assert(points.shape()[1] == 2 && "Delaunay triangulation expects 2D points");
+
+        return Triangulator(points, N).run();
+    }
+
+    VoronoiDiagram voronoiDiagram(
+        const NDArray<double, 2> &points,
+        const DelaunayTriangulation &triangulation)
+    {
+        const auto N = points.shape()[0];
+        const auto T = triangulation.numTriangles();
+        const auto &tris = triangulation.triangles;
+        const auto &halfedges = triangulation.halfedges;
+
+        VoronoiDiagram diagram{NDArray<double, 2>::Empty({T, 2}), {}, {}, {}};
+
+        for (size_type t = 0; t < T; ++t)
+        {
+            const double ax = points(tris[3 * t], 0);
+            const double ay = points(tris[3 * t], 1);
+            const double bx = points(tris[3 * t + 1], 0) - ax;
+            const double by = points(tris[3 * t + 1], 1) - ay;
+            const double cx = points(tris[3 * t + 2], 0) - ax;
+            const double cy = points(tris[3 * t + 2], 1) - ay;
+
+            const double b2 = bx * bx + by * by;
+            const double c2 = cx * cx + cy * cy;
+            const double d = 2.0 * (bx * cy - by * cx);
+
+            diagram.vertices(t, 0) = ax + (cy * b2 - by * c2) / d;
+            diagram.vertices(t, 1) = ay + (bx * c2 - cx * b2) / d;
+        }
+
+        // One outgoing half-edge per point, the hull edge for hull points
+        // so that walking counter-clockwise visits the whole fan
+        std::vector<size_type> outgoing(N, DelaunayTriangulation::NoHalfedge);
+        for (size_type e = 0; e < tris.size(); ++e)
+        {
+            const auto v = tris[e];
+            if (outgoing[v] == DelaunayTriangulation::NoHalfedge ||
+                halfedges[e] == DelaunayTriangulation::NoHalfedge)
+                outgoing[v] = e;
+        }
+
+        diagram.cellOffsets.resize(N + 1, 0);
+        diagram.unbounded.resize(N, 0);
+        diagram.cellVertices.reserve(tris.size());
+        for (size_type v = 0; v < N; ++v)
+        {
+            diagram.cellOffsets[v] = diagram.cellVertices.size();
+
+            const auto start = outgoing[v];
+            if (start == DelaunayTriangulation::NoHalfedge)
+                continue;
+
+            diagram.unbounded[v] = (halfedges[start] == DelaunayTriangulation::NoHalfedge) ? 1 : 0;
+
+            auto e = start;
+            do
+            {
+                diagram.cellVertices.push_back(e / 3);
+                e = halfedges[DelaunayTriangulation::prevHalfedge(e)];
+            } while (e != DelaunayTriangulation::NoHalfedge && e != start);
+        }
+        diagram.cellOffsets[N] = diagram.cellVertices.size();
+
+        return diagram;
+    }
+
+    /**************************************************************************/
+
+    namespace
+    {
+        void testDelaunayInvariants(const NDArray<double, 2> &points)
+        {
+            const auto N = points.shape()[0];
+            const auto triangulation = delaunayTriangulation(points);
+            const auto T = triangulation.numTriangles();
+            const auto &tris = triangulation.triangles;
+            const auto &halfedges = triangulation.halfedges;
+
+            const auto px = [&](size_type v)
+            { return points(v, 0); };
+            const auto py = [&](size_type v)
+            { return points(v, 1); };
+
+            // Half-edges are paired with their reverse
+            for (size_type e = 0; e < tris.size(); ++e)
+            {
+                DEBUG_ONLY const auto twin = halfedges[e];
+                assert((twin == DelaunayTriangulation::NoHalfedge ||
+                        (halfedges[twin] == e &&
+                         tris[twin] == tris[DelaunayTriangulation::nextHalfedge(e)] &&
+                         tris[DelaunayTriangulation::nextHalfedge(twin)] == tris[e])) &&
+                       "Half-edge pairing broken");
+            }
+
+            // Triangles are counter-clockwise and have empty circumcircles
+            for (size_type t = 0; t < T; ++t)
+            {
+                DEBUG_ONLY const auto a = tris[3 * t];
+                DEBUG_ONLY const auto b = tris[3 * t + 1];
+                DEBUG_ONLY const auto c = tris[3 * t + 2];
+                assert(orient2d(px(a), py(a), px(b), py(b), px(c), py(c)) > 0.0 &&
+                       "Triangle not counter-clockwise");
+
+                for (size_type i = 0; i < N; ++i)
+                {
+                    assert(incircle(px(a), py(a), px(b), py(b), px(c), py(c), px(i), py(i)) <= 0.0 &&
+                           "Point inside circumcircle");
+                }
+            }
+
+            // Euler: a triangulation of n points with h on the hull has 2n - 2 - h triangles
+            std::set<std::pair<double, double>> unique;
+            for (size_type i = 0; i < N; ++i)
+                unique.emplace(px(i), py(i));
+
+            const auto &hull = triangulation.hull;
+            assert((T == 0 || T == 2 * unique.size() - 2 - hull.size()) &&
+                   "Triangle count does not match Euler's formula");
+
+            // The hull matches computeConvexHull once collinear points are dropped
+            if (T > 0)
+            {
+                std::vector<size_type> strictHull;
+                const auto h = hull.size();
+                for (size_type i = 0; i < h; ++i)
+                {
+                    const auto prev = hull[(i + h - 1) % h];
+                    const auto cur = hull[i];
+                    const auto next = hull[(i + 1) % h];
+                    if (orient2d(px(prev), py(prev), px(cur), py(cur), px(next), py(next)) != 0.0)
+                        strictHull.push_back(cur);
+                }
+
+                const auto expected = computeConvexHull(points);
+                assert(expected.shape()[0] == strictHull.size() && "Hull size mismatch");
+                for (size_type i = 0; i < strictHull.size(); ++i)
+                {
+                    assert(expected(i, 0) == px(strictHull[i]) &&
+                           expected(i, 1) == py(strictHull[i]) &&
+                           "Hull point mismatch");
+                }
+            }
+
+            // Voronoi vertices are equidistant from their triangle's points
+            // and every cell walks around its point
+            const auto diagram = voronoiDiagram(points, triangulation);
+            for (size_type t = 0; t < T; ++t)
+            {
+                const auto cx = diagram.vertices(t, 0);
+                const auto cy = diagram.vertices(t, 1);
+                DEBUG_ONLY const auto r0 = std::hypot(px(tris[3 * t]) - cx, py(tris[3 * t]) - cy);
+                for (size_type k = 1; k < 3; ++k)
+                {
+                    DEBUG_ONLY const auto r = std::hypot(px(tris[3 * t + k]) - cx, py(tris[3 * t + k]) - cy);
+                    assert(std::abs(r - r0) <= 1e-6 * std::max(1.0, r0) &&
+                           "Voronoi vertex not equidistant");
+                }
+            }
+
+            size_type unbounded = 0;
+            for (size_type v = 0; v < N; ++v)
+            {
+                for (auto i = diagram.cellOffsets[v]; i < diagram.cellOffsets[v + 1]; ++i)
+                {
+                    DEBUG_ONLY const auto t = diagram.cellVertices[i];
+                    assert((tris[3 * t] == v || tris[3 * t + 1] == v || tris[3 * t + 2] == v) &&
+                           "Voronoi cell vertex not adjacent to its point");
+                }
+                unbounded += diagram.unbounded[v];
+            }
+            assert((T == 0 || unbounded == hull.size()) && "Unbounded cells do not match hull");
+        }
+    }
+
+    void testDelaunay()
+    {
+        std::cout << "Running tests for delaunayTriangulation..." << std::endl;
+
+        std::mt19937 rng(530); // Fixed seed for reproducibility
+        std::uniform_real_distribution<double> dist(-1000.0, 1000.0);
+        std::uniform_int_distribution<int> grid(-6, 6);
+
+        for (int iter = 0; iter < 200; ++iter)
+        {
+            const size_type numPoints = rng() % 250 + 1;
+            auto points = NDArray<double, 2>::Empty({numPoints, 2});
+
+            for (size_type i = 0; i < numPoints; ++i)
+            {
+                switch (iter % 4)
+                {
+                case 0: // Random
+                    points(i, 0) = dist(rng);
+                    points(i, 1) = dist(rng);
+                    break;
+                case 1: // Small integer grid, many duplicates and cocircular points
+                    points(i, 0) = grid(rng);
+                    points(i, 1) = grid(rng);
+                    break;
+                case 2: // Cocircular
+                {
+                    const double angle = 2.0 * pi * static_cast<double>(rng() % 16) / 16.0;
+                    points(i, 0) = std::round(1000.0 * std::cos(angle));
+                    points(i, 1) = std::round(1000.0 * std::sin(angle));
+                    break;
+                }
+                default: // Collinear with a few points off the line
+                    points(i, 0) = grid(rng);
+                    points(i, 1) = (i % 50 == 49) ? grid(rng) : 2.0 * points(i, 0) + 1.0;
+                    break;
+                }
+            }
+
+            testDelaunayInvariants(points);
+        }
+    }
+
+} // namespace Geometry
@@ -0,0 +1,234 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Sparsh Jain
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <cpp_eigen_opencv/shared/ndarray.hpp>
+#include <cpp_eigen_opencv/shared/distance_transform.hpp>
+#include <cpp_eigen_opencv/shared/parallel.hpp>
+#include <cpp_eigen_opencv/shared/trace.hpp>
+#include <cpp_eigen_opencv/shared/debug.hpp>
+
+namespace Geometry
+{
+    namespace
+    {
+        // Column distance of a pixel with no zero pixel in its column
+        constexpr std::uint32_t NoZero = std::numeric_limits<std::uint32_t>::max();
+
+        // Scratch for the lower envelope of one row
+        struct Envelope
+        {
+            std::vector<double> f{};      // squared column distance per column
+            std::vector<size_type> v{};   // columns of the envelope parabolas
+            std::vector<double> z{};      // left boundary of each parabola
+        };
+
+        // Squared distances along one row from the column distances g,
+        // written as distances to out
+        void transformRow(
+            const std::uint32_t *g,
+            const size_type cols,
+            Envelope &envelope,
+            float *out)
+        {
+            auto &f = envelope.f;
+            auto &v = envelope.v;
+            auto &z = envelope.z;
+
+            // Parabolas with no zero pixel in their column are skipped
+            size_type k = 0;
+            for (size_type q = 0; q < cols; ++q)
+            {
+                if (g[q] == NoZero)
+                    continue;
+
+                const auto dq = static_cast<double>(q);
+                f[q] = static_cast<double>(g[q]) * static_cast<double>(g[q]);
+
+                double s = -std::numeric_limits<double>::infinity();
+                while (k > 0)
+                {
+                    const auto p = v[k - 1];
+                    const auto dp = static_cast<double>(p);
+                    s = ((f[q] + dq * dq) - (f[p] + dp * dp)) / (2.0 * (dq - dp));
+                    if (s > z[k - 1])
+                        break;
+
+                    --k;
+                    s = -std::numeric_limits<double>::infinity();
+                }
+
+                v[k] = q;
+                z[k] = s;
+                ++k;
+            }
+
+            if (k == 0)
+            {
+                std::fill(out, out + cols, std::numeric_limits<float>::infinity());
+                return;
+            }
+
+            size_type j = 0;
+            for (size_type q = 0; q < cols; ++q)
+            {
+                while (j + 1 < k && z[j + 1] < static_cast<double>(q))
+                    ++j;
+
+                const auto dx = static_cast<double>(q) - static_cast<double>(v[j]);
+                out[q] = static_cast<float>(std::sqrt(dx * dx + f[v[j]]));
+            }
+        }
+    }
+
+    NDArray<float, 2> distanceTransform(const NDArray<std::uint8_t, 2> &mask)
+    {
+        TRACE_SCOPE("distanceTransform");
+        const auto rows = mask.shape()[0];
+        const auto cols = mask.shape()[1];
+
+        auto result = NDArray<float, 2>::Empty({rows, cols});
+        if (rows == 0 || cols == 0)
+            return result;
+
+        // Distance to the nearest zero pixel in the same column, one scan
+        // down and one up. Threads own blocks of columns and walk the
+        // rows, so every scan reads contiguous row segments.
+        std::vector<std::uint32_t> g(rows * cols);
+        const auto columnChunks = Parallel::chunkCount(cols, std::max<size_type>(64, (1 << 16) / rows));
+        Parallel::parallelForChunks(0, cols, columnChunks, [&](size_type lo, size_type hi, size_type)
+                                    {
+                                        TRACE_SCOPE("distanceTransform.columns");
+                                        for (auto x = lo; x < hi; ++x)
+                                            g[x] = (mask(0, x) == 0) ? 0 : NoZero;
+
+                                        for (size_type y = 1; y < rows; ++y)
+                                        {
+                                            const auto *above = &g[(y - 1) * cols];
+                                            auto *row = &g[y * cols];
+                                            for (auto x = lo; x < hi; ++x)
+                                                row[x] = (mask(y, x) == 0) ? 0 : ((above[x] == NoZero) ? NoZero : above[x] + 1);
+                                        }
+
+                                        for (auto y = rows - 1; y-- > 0;)
+                                        {
+                                            const auto *below = &g[(y + 1) * cols];
+                                            auto *row = &g[y * cols];
+                                            for (auto x = lo; x < hi; ++x)
+                                            {
+                                                if (below[x] != NoZero)
+                                                    row[x] = std::min(row[x], below[x] + 1);
+                                            }
+                                        } });
+
+        // Lower envelope along every row, one scratch envelope per thread
+        const auto rowChunks = Parallel::chunkCount(rows, std::max<size_type>(1, (1 << 14) / cols));
+        Parallel::parallelForChunks(0, rows, rowChunks, [&](size_type lo, size_type hi, size_type)
+                                    {
+                                        TRACE_SCOPE("distanceTransform.rows");
+                                        Envelope envelope{std::vector<double>(cols),
+                                                          std::vector<size_type>(cols),
+                                                          std::vector<double>(cols)};
+                                        for (auto y = lo; y < hi; ++y)
+                                            transformRow(&g[y * cols], cols, envelope, &result(y, 0)); });
+
+        return result;
+    }
+
+    /**************************************************************************/
+
+    namespace
+    {
+        // Distance to the nearest zero pixel by checking all of them
+        NDArray<float, 2> bruteForceDistanceTransform(const NDArray<std::uint8_t, 2> &mask)
+        {
+            const auto rows = mask.shape()[0];
+            const auto cols = mask.shape()[1];
+
+            std::vector<std::pair<double, double>> zeros;
+            for (size_type y = 0; y < rows; ++y)
+            {
+                for (size_type x = 0; x < cols; ++x)
+                {
+                    if (mask(y, x) == 0)
+                        zeros.emplace_back(static_cast<double>(x), static_cast<double>(y));
+                }
+            }
+
+            auto result = NDArray<float, 2>::Empty({rows, cols});
+            for (size_type y = 0; y < rows; ++y)
+            {
+                for (size_type x = 0; x < cols; ++x)
+                {
+                    double best = std::numeric_limits<double>::infinity();
+                    for (const auto &[zx, zy] : zeros)
+                    {
+                        const double dx = static_cast<double>(x) - zx;
+                        const double dy = static_cast<double>(y) - zy;
+                        best = std::min(best, dx * dx + dy * dy);
+                    }
+                    result(y, x) = static_cast<float>(std::sqrt(best));
+                }
+            }
+            return result;
+        }
+    }
+
+    void testDistanceTransform()
+    {
+        std::cout << "Running tests for distanceTransform..." << std::endl;
+
+        std::mt19937 rng(59); // Fixed seed for reproducibility
+        std::uniform_real_distribution<double> density(0.0, 1.0);
+
+        for (int iter = 0; iter < 300; ++iter)
+        {
+            // Thin shapes, sparse and dense zero pixels, including masks
+            // without any zero pixel
+            const size_type rows = rng() % 60 + 1;
+            const size_type cols = rng() % 60 + 1;
+            const double zeroFraction = (iter % 10 == 0) ? 0.0 : density(rng) * density(rng);
+            std::bernoulli_distribution zero(zeroFraction);
+
+            auto mask = NDArray<std::uint8_t, 2>::Empty({rows, cols});
+            for (size_type y = 0; y < rows; ++y)
+            {
+                for (size_type x = 0; x < cols; ++x)
+                    mask(y, x) = zero(rng) ? 0 : static_cast<std::uint8_t>(rng() % 255 + 1);
+            }
+
+            DEBUG_ONLY const auto result = distanceTransform(mask);
+            DEBUG_ONLY const auto expected = bruteForceDistanceTransform(mask);
+            assert(result.shape() == expected.shape() && "distanceTransform shape mismatch");
+            for (size_type y = 0; y < rows; ++y)
+            {
+                for (size_type x = 0; x < cols; ++x)
+                {
+                    assert(result(y, x) == expected(y, x) && "distanceTransform mismatch");
+                    assert((mask(y, x) != 0 || result(y, x) == 0.0f) && "Zero pixel has a distance");
+                }
+            }
+        }
+
+        // A single zero pixel in the corner of a large mask
+        auto corner = NDArray<std::uint8_t, 2>::Full({300, 200}, 1);
+        corner(299, 0) = 0;
+        DEBUG_ONLY const auto cornerResult = distanceTransform(corner);
+        assert(cornerResult(0, 199) == static_cast<float>(std::hypot(299.0, 199.0)) &&
+               "Corner distance mismatch");
+
+        DEBUG_ONLY const auto empty = distanceTransform(NDArray<std::uint8_t, 2>::Empty({0, 5}));
+        assert(empty.size() == 0 && "Empty mask gives a non-empty result");
+    }
+
+} // namespace Geometry
@@ -0,0 +1,471 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Sparsh Jain
+ *
+ */
+
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+#include <string>
+
+#include <cpp_eigen_opencv/shared/dynarray.hpp>
+#include <cpp_eigen_opencv/shared/debug.hpp>
+
+namespace ND
+{
+    namespace
+    {
+        size_type product(const std::vector<size_type> &shape)
+        {
+            return std::reduce(shape.begin(), shape.end(), size_type{1}, std::multiplies<size_type>{});
+        }
+
+        // One dtype switch, then the typed NDArray operator on flat views
+        template <typename Op>
+        DynArray elementwise(const DynArray &a, const DynArray &b, Op op)
+        {
+            assert(a.dtype() == b.dtype() && "DType mismatch");
+            assert(a.shape() == b.shape() && "Shape Mismatch");
+
+            return visitDType(a.dtype(), [&]<typename T>(std::type_identity<T>)
+                              { return DynArray(op(a.flat<T>(), b.flat<T>())).reshape(a.shape()); });
+        }
+
+        template <typename Op>
+        DynArray elementwise(const DynArray &a, double b, Op op)
+        {
+            return visitDType(a.dtype(), [&]<typename T>(std::type_identity<T>)
+                              { return DynArray(op(a.flat<T>(), b)).reshape(a.shape()); });
+        }
+
+        // NumPy descr strings of the dtypes, all little-endian
+        const char *npyDescr(DType dtype)
+        {
+            switch (dtype)
+            {
+            case DType::UInt8:
+                return "|u1";
+            case DType::Int16:
+                return "<i2";
+            case DType::UInt16:
+                return "<u2";
+            case DType::Int32:
+                return "<i4";
+            case DType::Int64:
+                return "<i8";
+            case DType::Float32:
+                return "<f4";
+            case DType::Float64:
+                break;
+            }
+            return "<f8";
+        }
+
+        // Value of 'key': in the header dictionary, up to the next comma
+        // or closing bracket at the same level
+        std::optional<std::string> npyField(const std::string &header, const std::string &key)
+        {
+            const auto at = header.find("'" + key + "'");
+            if (at == std::string::npos)
+                return std::nullopt;
+
+            auto begin = header.find(':', at);
+            if (begin == std::string::npos)
+                return std::nullopt;
+            begin = header.find_first_not_of(' ', begin + 1);
+            if (begin == std::string::npos)
+                return std::nullopt;
+
+            const auto end = (header[begin] == '(') ? header.find(')', begin) + 1 : header.find_first_of(",}", begin);
+            if (end == std::string::npos || end == 0)
+                return std::nullopt;
+            return header.substr(begin, end - begin);
+        }
+    }
+
+    namespace Detail
+    {
+        size_type remainingBytes(std::istream &in)
+        {
+            if (in.eof())
+                return 0;
+
+            const auto position = in.tellg();
+            if (position < 0 || !in.seekg(0, std::ios::end))
+            {
+                in.clear();
+                return std::numeric_limits<size_type>::max();
+            }
+            const auto end = in.tellg();
+            in.seekg(position);
+            return static_cast<size_type>(end - position);
+        }
+    }
+
+    size_type dtypeSize(DType dtype)
+    {
+        return visitDType(dtype, []<typename T>(std::type_identity<T>)
+                          { return sizeof(T); });
+    }
+
+    const char *dtypeName(DType dtype)
+    {
+        switch (dtype)
+        {
+        case DType::UInt8:
+            return "uint8";
+        case DType::Int16:
+            return "int16";
+        case DType::UInt16:
+            return "uint16";
+        case DType::Int32:
+            return "int32";
+        case DType::Int64:
+            return "int64";
+        case DType::Float32:
+            return "float32";
+        case DType::Float64:
+            break;
+        }
+        return "float64";
+    }
+
+    DynArray::DynArray()
+        : DynArray(Empty(DType::Float64, {0}))
+    {
+    }
+
+    DynArray::DynArray(void *data, DType dtype, std::vector<size_type> shape, std::shared_ptr<void> owner)
+        : m_owned_data(std::move(owner)),
+          m_data(static_cast<std::byte *>(data)),
+          m_dtype(dtype),
+          m_shape(std::move(shape)),
+          m_strides(m_shape.size()),
+          m_size(1)
+    {
+        assert((data != nullptr || product(m_shape) == 0) && "Null pointer");
+        for (size_type i = m_shape.size(); i > 0; --i)
+        {
+            m_strides[i - 1] = m_size;
+            m_size *= m_shape[i - 1];
+        }
+    }
+
+    DynArray DynArray::Empty(DType dtype, std::vector<size_type> shape)
+    {
+        // Allocated as the element type, so the buffer is aligned for it
+        // and counted like any NDArray buffer
+        const auto size = product(shape);
+        auto owned_data = visitDType(dtype, [size]<typename T>(std::type_identity<T>)
+                                     { return std::shared_ptr<void>(Detail::allocateArray<T>(size)); });
+        auto *data = owned_data.get();
+        return DynArray(data, dtype, std::move(shape), std::move(owned_data));
+    }
+
+    DynArray DynArray::Zeros(DType dtype, std::vector<size_type> shape)
+    {
+        auto array = Empty(dtype, std::move(shape));
+        std::fill(array.m_data, array.m_data + array.nbytes(), std::byte{0});
+        return array;
+    }
+
+    DynArray DynArray::reshape(std::vector<size_type> shape) const
+    {
+        assert(product(shape) == m_size && "Reshape changes the size");
+        return DynArray(m_data, m_dtype, std::move(shape), m_owned_data);
+    }
+
+    double DynArray::at(size_type i) const
+    {
+        assert(i < m_size && "Index out of bounds");
+        return visitDType(m_dtype, [&]<typename T>(std::type_identity<T>)
+                          { return static_cast<double>(typed<T>()[i]); });
+    }
+
+    DynArray DynArray::Copy() const
+    {
+#ifdef ND_TRACK_ALLOCATIONS
+        Detail::recordCopy();
+#endif
+        auto array = Empty(m_dtype, m_shape);
+        std::copy(m_data, m_data + nbytes(), array.m_data);
+        return array;
+    }
+
+    DynArray DynArray::AsType(DType dtype, double scale, double offset, Rounding rounding) const
+    {
+        return visitDType(m_dtype, [&]<typename T>(std::type_identity<T>)
+                          { return visitDType(dtype, [&]<typename U>(std::type_identity<U>)
+                                              { return DynArray(flat<T>().template AsType<U>(scale, offset, rounding)).reshape(m_shape); }); });
+    }
+
+    DynArray operator+(const DynArray &a, const DynArray &b)
+    {
+        return elementwise(a, b, [](const auto &x, const auto &y)
+                           { return x + y; });
+    }
+
+    DynArray operator-(const DynArray &a, const DynArray &b)
+    {
+        return elementwise(a, b, [](const auto &x, const auto &y)
+                           { return x - y; });
+    }
+
+    DynArray operator*(const DynArray &a, const DynArray &b)
+    {
+        return elementwise(a, b, [](const auto &x, const auto &y)
+                           { return x * y; });
+    }
+
+    DynArray operator/(const DynArray &a, const DynArray &b)
+    {
+        return elementwise(a, b, [](const auto &x, const auto &y)
+                           { return x / y; });
+    }
+
+    DynArray operator+(const DynArray &a, double b)
+    {
+        return elementwise(a, b, [](const auto &x, double y)
+                           { return x + y; });
+    }
+
+    DynArray operator-(const DynArray &a, double b)
+    {
+        return elementwise(a, b, [](const auto &x, double y)
+                           { return x - y; });
+    }
+
+    DynArray operator*(const DynArray &a, double b)
+    {
+        return elementwise(a, b, [](const auto &x, double y)
+                           { return x * y; });
+    }
+
+    DynArray operator/(const DynArray &a, double b)
+    {
+        return elementwise(a, b, [](const auto &x, double y)
+                           { return x / y; });
+    }
+
+    double dot(const DynArray &a, const DynArray &b)
+    {
+        assert(a.dtype() == b.dtype() && "DType mismatch");
+        assert(a.size() == b.size() && "Shape Mismatch");
+
+        // Narrow integers would overflow their int products, so only the
+        // kernel types use the typed dot
+        return visitDType(a.dtype(), [&]<typename T>(std::type_identity<T>)
+                          {
+                              if constexpr (Kernels::Element<T>)
+                                  return static_cast<double>(dot(a.flat<T>(), b.flat<T>()));
+                              else
+                              {
+                                  const auto *x = a.data<T>();
+                                  const auto *y = b.data<T>();
+                                  double result = 0.0;
+                                  for (size_type i = 0; i < a.size(); ++i)
+                                      result += static_cast<double>(x[i]) * static_cast<double>(y[i]);
+                                  return result;
+                              } });
+    }
+
+    std::optional<DynArray> readNpy(std::istream &in)
+    {
+        if constexpr (std::endian::native != std::endian::little)
+            return std::nullopt;
+
+        char magic[8] = {};
+        if (!in.read(magic, sizeof(magic)) || std::memcmp(magic, "\x93NUMPY", 6) != 0)
+            return std::nullopt;
+
+        // Version 1 has a 16-bit header length, 2 and 3 a 32-bit one
+        const auto major = static_cast<unsigned char>(magic[6]);
+        unsigned char length[4] = {};
+        const auto lengthBytes = (major == 1) ? 2 : 4;
+        if (major < 1 || major > 3 || !in.read(reinterpret_cast<char *>(length), lengthBytes))
+            return std::nullopt;
+
+        size_type headerLength = 0;
+        for (int i = lengthBytes; i > 0; --i)
+            headerLength = (headerLength << 8) | static_cast<size_type>(length[i - 1]);
+
+        if (headerLength > Detail::remainingBytes(in))
+            return std::nullopt;
+
+        std::string header(headerLength, '\0');
+        if (!in.read(header.data(), static_cast<std::streamsize>(headerLength)))
+            return std::nullopt;
+
+        const auto descr = npyField(header, "descr");
+        const auto fortran = npyField(header, "fortran_order");
+        const auto shapeText = npyField(header, "shape");
+        if (!descr || !fortran || !shapeText || *fortran != "False")
+            return std::nullopt;
+
+        // Single byte types are stored as |u1, numpy also accepts <u1
+        std::optional<DType> dtype;
+        for (const auto candidate : {DType::UInt8, DType::Int16, DType::UInt16, DType::Int32,
+                                     DType::Int64, DType::Float32, DType::Float64})
+        {
+            const std::string name = npyDescr(candidate);
+            if (*descr == "'" + name + "'" || (name[0] == '|' && *descr == "'<" + name.substr(1) + "'"))
+                dtype = candidate;
+        }
+        if (!dtype)
+            return std::nullopt;
+
+        // The data has to be there before the array is allocated
+        std::vector<size_type> shape;
+        size_type bytes = dtypeSize(*dtype);
+        std::istringstream dimensions(shapeText->substr(1, shapeText->size() - 2));
+        for (std::string dimension; std::getline(dimensions, dimension, ',');)
+        {
+            const auto first = dimension.find_first_not_of(' ');
+            if (first == std::string::npos)
+                continue;
+            const auto last = dimension.find_last_not_of(' ') + 1;
+
+            size_type length = 0;
+            const auto [next, error] = std::from_chars(dimension.data() + first, dimension.data() + last, length);
+            if (error != std::errc{} || next != dimension.data() + last)
+                return std::nullopt;
+            if (length != 0 && bytes > std::numeric_limits<size_type>::max() / length)
+                return std::nullopt;
+            bytes *= length;
+            shape.push_back(length);
+        }
+        if (bytes > Detail::remainingBytes(in))
+            return std::nullopt;
+
+        auto array = DynArray::Empty(*dtype, shape);
+        if (!in.read(static_cast<char *>(array.data()), static_cast<std::streamsize>(array.nbytes())))
+            return std::nullopt;
+        return array;
+    }
+
+    bool writeNpy(std::ostream &out, const DynArray &array)
+    {
+        if constexpr (std::endian::native != std::endian::little)
+            return false;
+
+        std::string header = "{'descr': '" + std::string(npyDescr(array.dtype())) + "', 'fortran_order': False, 'shape': (";
+        // numpy writes (3,) for one dimension and (3, 4) for more
+        for (size_type i = 0; i < array.ndim(); ++i)
+            header += ((i == 0) ? "" : ", ") + std::to_string(array.shape()[i]);
+        header += (array.ndim() == 1) ? ",), }" : "), }";
+
+        // Magic, version and length take 10 bytes, the data starts on a
+        // 64 byte boundary after the newline terminated header
+        const auto total = (10 + header.size() + 1 + 63) / 64 * 64;
+        header.append(total - 10 - header.size() - 1, ' ');
+        header += '\n';
+
+        const auto length = static_cast<std::uint16_t>(header.size());
+        const char preamble[10] = {'\x93', 'N', 'U', 'M', 'P', 'Y', 1, 0,
+                                   static_cast<char>(length & 0xff), static_cast<char>(length >> 8)};
+        out.write(preamble, sizeof(preamble));
+        out.write(header.data(), static_cast<std::streamsize>(header.size()));
+        out.write(static_cast<const char *>(array.data()), static_cast<std::streamsize>(array.nbytes()));
+        return static_cast<bool>(out);
+    }
+
+    /**************************************************************************/
+
+    void testDynArray()
+    {
+        std::cout << "Running tests for DynArray..." << std::endl;
+
+        // Zero-copy round trip through NDArray
+        auto typed = NDArray<float, 2>::Empty({2, 3});
+        for (size_type i = 0; i < typed.size(); ++i)
+            typed[i] = static_cast<float>(i);
+
+        const DynArray dynamic(typed);
+        assert(dynamic.dtype() == DType::Float32 && dynamic.ndim() == 2 && dynamic.size() == 6 &&
+               dynamic.shape()[1] == 3 && dynamic.strides()[0] == 3 && "Wrong DynArray metadata");
+        assert(dynamic.data() == typed.data() && "DynArray copied the NDArray buffer");
+        auto view = dynamic.as<float, 2>();
+        view(1, 2) = 42.0f;
+        assert(typed(1, 2) == 42.0f && dynamic.at(5) == 42.0 && "Typed view does not share the buffer");
+
+        // One dtype switch per operation, results follow the typed operators
+        for (const auto dtype : {DType::UInt8, DType::Int16, DType::UInt16, DType::Int32,
+                                 DType::Int64, DType::Float32, DType::Float64})
+        {
+            auto a = DynArray::Zeros(dtype, {4, 10});
+            visitDType(dtype, [&]<typename T>(std::type_identity<T>)
+                       {
+                           auto values = a.flat<T>();
+                           for (size_type i = 0; i < values.size(); ++i)
+                               values[i] = static_cast<T>(i % 7 + 1); });
+
+            const auto sum = a + a;
+            const auto quotient = a / a;
+            const auto scaled = a * 0.5;
+            assert(sum.shape() == a.shape() && scaled.dtype() == DType::Float64 && "Wrong result metadata");
+            assert((dtypeSize(dtype) >= 4 ? sum.dtype() == dtype : sum.dtype() == DType::Int32) &&
+                   "Result dtype differs from the typed operator");
+            for (size_type i = 0; i < a.size(); ++i)
+            {
+                assert(sum.at(i) == 2.0 * a.at(i) && quotient.at(i) == 1.0 && scaled.at(i) == 0.5 * a.at(i) &&
+                       "Wrong element-wise result");
+            }
+
+            DEBUG_ONLY double expected = 0.0;
+            for (size_type i = 0; i < a.size(); ++i)
+                expected += a.at(i) * a.at(i);
+            assert(dot(a, a) == expected && "Wrong DynArray dot");
+
+            // .npy round trip keeps dtype, shape and bytes
+            std::stringstream file;
+            assert(writeNpy(file, a) && "writeNpy failed");
+            assert(file.str().size() % 64 == a.nbytes() % 64 && "Data not 64 byte aligned");
+            DEBUG_ONLY const auto read = readNpy(file);
+            assert(read && read->dtype() == dtype && read->shape() == a.shape() &&
+                   std::memcmp(read->data(), a.data(), a.nbytes()) == 0 && "Wrong .npy round trip");
+        }
+
+        // Conversion saturates and rounds like NDArray::AsType
+        {
+            auto pixels = DynArray::Zeros(DType::Float32, {2, 2});
+            const float values[4] = {-3.0f, 2.5f, 3.5f, 300.0f};
+            std::copy(values, values + 4, pixels.data<float>());
+            DEBUG_ONLY const auto bytes = pixels.AsType(DType::UInt8);
+            assert(bytes.dtype() == DType::UInt8 && bytes.shape() == pixels.shape() && bytes.at(0) == 0.0 &&
+                   bytes.at(1) == 2.0 && bytes.at(2) == 4.0 && bytes.at(3) == 255.0 && "Wrong AsType");
+            DEBUG_ONLY const auto scaled = bytes.AsType(DType::Float64, 0.5, 1.0);
+            assert(scaled.dtype() == DType::Float64 && scaled.at(3) == 128.5 && "Wrong scaled AsType");
+        }
+
+        // Header as numpy writes it for np.arange(3, dtype=np.int16)
+        std::string npy("\x93NUMPY\x01\x00\x76\x00", 10);
+        std::string header = "{'descr': '<i2', 'fortran_order': False, 'shape': (3,), }";
+        header.append(0x76 - header.size() - 1, ' ');
+        npy += header + "\n" + std::string("\x00\x00\x01\x00\x02\x00", 6);
+        std::istringstream numpyFile(npy);
+        DEBUG_ONLY const auto arange = readNpy(numpyFile);
+        assert(arange && arange->dtype() == DType::Int16 && arange->shape() == std::vector<size_type>{3} &&
+               arange->at(2) == 2.0 && "numpy file not read");
+
+        std::istringstream fortranFile(std::string("\x93NUMPY\x01\x00\x3a\x00", 10) +
+                                       "{'descr': '<f8', 'fortran_order': True, 'shape': (1,), }\n");
+        assert(!readNpy(fortranFile) && "Fortran order accepted");
+
+        // Malformed shapes and missing data are rejected, not thrown
+        std::istringstream badShape(std::string("\x93NUMPY\x01\x00\x3c\x00", 10) +
+                                    "{'descr': '<f8', 'fortran_order': False, 'shape': (x, 2), }\n");
+        assert(!readNpy(badShape) && "Malformed shape accepted");
+        std::istringstream noData(std::string("\x93NUMPY\x01\x00\x46\x00", 10) +
+                                  "{'descr': '<f8', 'fortran_order': False, 'shape': (100000, 100000), }\n");
+        assert(!readNpy(noData) && "Shape larger than the data accepted");
+    }
+
+} // namespace ND
@@ -5,11 +5,19 @@
  *
  */
 
+#include <algorithm>
+#include <cstdint>
 #include <iostream>
+#include <limits>
 #include <random>
+#include <set>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <cpp_eigen_opencv/shared/ndarray.hpp>
 #include <cpp_eigen_opencv/shared/geometry.hpp>
+#include <cpp_eigen_opencv/shared/parallel.hpp>
 #include <cpp_eigen_opencv/shared/debug.hpp>
 
 namespace Geometry
@@ -24,63 +32,31 @@ namespace Geometry
         if (n < 3)
             return; // Trivial hull, no need to test further
 
-        constexpr double eps = 1e-6;
-        constexpr auto equal = [](double a, double b)
-        {
-            return std::abs(a - b) < eps;
-        };
+        DEBUG_ONLY constexpr double eps = 1e-6;
+
+        // Hull Points are a subset of input points, they are copied
+        // from the input, so they compare equal
+        std::vector<std::pair<double, double>> inputs(N);
+        for (size_type j = 0; j < N; ++j)
+            inputs[j] = {points(j, 0), points(j, 1)};
+        std::sort(inputs.begin(), inputs.end());
 
-        // Hull Points are a subset of input points
         for (size_type i = 0; i < n; ++i)
         {
-            DEBUG_ONLY bool found = false;
-            for (size_type j = 0; j < N; ++j)
-            {
-                if ((equal(hull(i, 0), points(j, 0))) &&
-                    (equal(hull(i, 1), points(j, 1))))
-                {
-                    found = true;
-                    break;
-                }
-            }
-
-            assert(found && "Hull point not found in input points");
+            assert(std::binary_search(inputs.begin(), inputs.end(), std::pair{hull(i, 0), hull(i, 1)}) &&
+                   "Hull point not found in input points");
         }
 
         // Hull points are convex in counter-clockwise order
         for (size_type i = 0; i < n; ++i)
         {
-            const auto p0 = NDArray<const double, 1>(&hull(i, 0), {2});
-            const auto p1 = NDArray<const double, 1>(&hull((i + 1) % n, 0), {2});
-            const auto p2 = NDArray<const double, 1>(&hull((i + 2) % n, 0), {2});
-
-            const auto v1 = p1 - p0;
-            const auto v2 = p2 - p1;
-
-            DEBUG_ONLY const auto crossProduct = cross(v1, v2);
-            assert(crossProduct >= -eps && "Hull points not in counter-clockwise order");
+            assert(Detail::orientation(hull, i, (i + 1) % n, (i + 2) % n) >= -eps &&
+                   "Hull points not in counter-clockwise order");
         }
 
-        // All points lie inside or on the hull
+        // All points lie inside or on the hull, O(log n) each
         for (size_type i = 0; i < N; ++i)
-        {
-            const auto p = NDArray<const double, 1>(&points(i, 0), {2});
-            DEBUG_ONLY bool inside = true;
-            for (size_type j = 0; j < n; ++j)
-            {
-                const auto p0 = NDArray<const double, 1>(&hull(j, 0), {2});
-                const auto p1 = NDArray<const double, 1>(&hull((j + 1) % n, 0), {2});
-                const auto edge = p1 - p0;
-                const auto toPoint = p - p0;
-                const auto crossProduct = cross(edge, toPoint);
-                if (crossProduct < -eps)
-                {
-                    inside = false;
-                    break;
-                }
-            }
-            assert(inside && "Point not inside hull");
-        }
+            assert(Detail::insideConvex(hull, points(i, 0), points(i, 1), eps) && "Point not inside hull");
     }
 
     void testMinAreaRectangleInvariants(
@@ -122,46 +98,214 @@ namespace Geometry
     {
         std::cout << "Running tests for computeConvexHull..." << std::endl;
 
-        // Generate random points and test computeConvexHull invariants
-        std::mt19937 rng(42); // Fixed seed for reproducibility
-        std::uniform_real_distribution<double> dist(-1000.0, 1000.0);
+        // Random point sets sharded across threads, fixed seed for
+        // reproducibility
+        Parallel::forEachTrial(1000, 42, [](std::mt19937 &rng, size_type)
+                               {
+                                   std::uniform_real_distribution<double> dist(-1000.0, 1000.0);
+                                   const size_type numPoints = rng() % 1000 + 1;
+                                   auto points = NDArray<double, 2>::Empty({numPoints, 2});
 
-        for (int iter = 0; iter < 1000; ++iter)
-        {
-            const size_type numPoints = rng() % 1000 + 1;
-            auto points = NDArray<double, 2>::Empty({numPoints, 2});
+                                   for (size_type i = 0; i < numPoints; ++i)
+                                   {
+                                       points(i, 0) = dist(rng);
+                                       points(i, 1) = dist(rng);
+                                   }
 
-            for (size_type i = 0; i < numPoints; ++i)
-            {
-                points(i, 0) = dist(rng);
-                points(i, 1) = dist(rng);
-            }
+                                   testConvexHullInvariants(points); });
 
-            testConvexHullInvariants(points);
-        }
+        // A strided view, the transpose of a 2 x N array, gives the same hull
+        std::mt19937 rng(43);
+        std::uniform_real_distribution<double> dist(-1000.0, 1000.0);
+        auto rows = NDArray<double, 2>::Empty({2, 500});
+        for (size_type i = 0; i < rows.size(); ++i)
+            rows[i] = dist(rng);
+        const auto view = rows.Transpose();
+        DEBUG_ONLY const auto hull = computeConvexHull(view);
+        DEBUG_ONLY const auto expected = computeConvexHull(view.Copy());
+        DEBUG_ONLY bool same = !view.IsContiguous() && hull.shape() == expected.shape();
+        for (size_type i = 0; same && i < hull.size(); ++i)
+            same = hull[i] == expected[i];
+        assert(same && "Hull of a strided view differs");
     }
 
     void testMinAreaRectangle()
     {
         std::cout << "Running tests for minAreaRectangle..." << std::endl;
 
-        // Generate random points and test minAreaRectangle invariants
-        std::mt19937 rng(123); // Fixed seed for reproducibility
-        std::uniform_real_distribution<double> dist(-1000.0, 1000.0);
+        // Random point sets sharded across threads, fixed seed for
+        // reproducibility
+        Parallel::forEachTrial(1000, 123, [](std::mt19937 &rng, size_type)
+                               {
+                                   std::uniform_real_distribution<double> dist(-1000.0, 1000.0);
+                                   const size_type numPoints = rng() % 1000 + 1;
+                                   auto points = NDArray<double, 2>::Empty({numPoints, 2});
 
-        for (int iter = 0; iter < 1000; ++iter)
+                                   for (size_type i = 0; i < numPoints; ++i)
+                                   {
+                                       points(i, 0) = dist(rng);
+                                       points(i, 1) = dist(rng);
+                                   }
+
+                                   testMinAreaRectangleInvariants(points); });
+    }
+
+    namespace
+    {
+        template <PixelIntegral T>
+        void testIntegerInvariants(const NDArray<T, 2> &points)
         {
-            const size_type numPoints = rng() % 1000 + 1;
-            auto points = NDArray<double, 2>::Empty({numPoints, 2});
+            const auto N = points.shape()[0];
+
+            // Packed argsort matches a comparison sort on the coordinates
+            for (const auto order : {Ascending, Descending})
+            {
+                const auto indices = argSortPoints(points, order);
+                assert(indices.size() == N && "argSortPoints lost points");
+                for (size_type i = 1; i < N; ++i)
+                {
+                    DEBUG_ONLY const auto previous = std::pair{points(indices[i - 1], 0), points(indices[i - 1], 1)};
+                    DEBUG_ONLY const auto current = std::pair{points(indices[i], 0), points(indices[i], 1)};
+                    assert(((order == Ascending) ? previous <= current : previous >= current) &&
+                           "argSortPoints out of order");
+                }
+            }
+
+            // Hull is strictly convex and contains every point, checked
+            // with the exact orientation test
+            const auto hull = computeConvexHull(points);
+            const auto n = hull.shape()[0];
+            if (n >= 3)
+            {
+                std::set<std::pair<T, T>> inputs;
+                for (size_type i = 0; i < N; ++i)
+                    inputs.emplace(points(i, 0), points(i, 1));
+
+                for (size_type i = 0; i < n; ++i)
+                {
+                    assert(inputs.contains({hull(i, 0), hull(i, 1)}) &&
+                           "Hull point not found in input points");
+                    assert(Detail::orientation(hull, i, (i + 1) % n, (i + 2) % n) > 0 &&
+                           "Hull is not strictly convex");
+                }
+
+                for (size_type j = 0; j < N; ++j)
+                    assert(Detail::insideConvex(hull, points(j, 0), points(j, 1)) && "Point not inside hull");
+            }
 
-            for (size_type i = 0; i < numPoints; ++i)
+            // Rectangle contains every point, up to rounding of the final
+            // floating point rectangle
+            const auto rectangle = minAreaRectangle(points);
+            DEBUG_ONLY const double cosA = std::cos(rectangle.angle);
+            DEBUG_ONLY const double sinA = std::sin(rectangle.angle);
+            DEBUG_ONLY const double eps = 1e-9 * (1.0 + std::max(rectangle.size[0], rectangle.size[1]) +
+                                                  std::abs(rectangle.center[0]) + std::abs(rectangle.center[1]));
+            for (size_type i = 0; i < N; ++i)
             {
-                points(i, 0) = dist(rng);
-                points(i, 1) = dist(rng);
+                DEBUG_ONLY const double dx = static_cast<double>(points(i, 0)) - rectangle.center[0];
+                DEBUG_ONLY const double dy = static_cast<double>(points(i, 1)) - rectangle.center[1];
+                assert(std::abs(dx * cosA + dy * sinA) <= rectangle.size[0] * 0.5 + eps &&
+                       std::abs(dy * cosA - dx * sinA) <= rectangle.size[1] * 0.5 + eps &&
+                       "Point lies outside the minimum area rectangle");
             }
 
-            testMinAreaRectangleInvariants(points);
+            // 16-bit coordinates are exact in double, so the generic path
+            // must find the same hull and the same area
+            if constexpr (sizeof(T) <= 2)
+            {
+                auto converted = NDArray<double, 2>::Empty({N, 2});
+                for (size_type i = 0; i < N; ++i)
+                {
+                    converted(i, 0) = points(i, 0);
+                    converted(i, 1) = points(i, 1);
+                }
+
+                const auto expectedHull = computeConvexHull(converted);
+                assert(expectedHull.shape()[0] == n && "Integer hull size mismatch");
+                for (size_type i = 0; i < n; ++i)
+                    assert(expectedHull(i, 0) == hull(i, 0) && expectedHull(i, 1) == hull(i, 1) &&
+                           "Integer hull mismatch");
+
+                DEBUG_ONLY const auto expected = minAreaRectangle(converted);
+                DEBUG_ONLY const double area = rectangle.size[0] * rectangle.size[1];
+                DEBUG_ONLY const double expectedArea = expected.size[0] * expected.size[1];
+                assert(std::abs(area - expectedArea) <= 1e-9 * (1.0 + expectedArea) &&
+                       "Integer rectangle area mismatch");
+            }
         }
+
+        template <PixelIntegral T>
+        void testIntegerType(const std::uint32_t seed, const size_type trials)
+        {
+            Parallel::forEachTrial(trials, seed, [](std::mt19937 &rng, size_type trial)
+                                   {
+                                       std::uniform_int_distribution<T> full(std::numeric_limits<T>::min(), std::numeric_limits<T>::max());
+                                       std::uniform_int_distribution<T> grid(-8, 8);
+
+                                       const size_type numPoints = rng() % 500 + 1;
+                                       auto points = NDArray<T, 2>::Empty({numPoints, 2});
+
+                                       for (size_type i = 0; i < numPoints; ++i)
+                                       {
+                                           // Every other set on a small grid to get duplicates and
+                                           // collinear runs
+                                           points(i, 0) = (trial % 2 == 0) ? full(rng) : grid(rng);
+                                           points(i, 1) = (trial % 2 == 0) ? full(rng) : grid(rng);
+                                       }
+
+                                       testIntegerInvariants(points); });
+        }
+    }
+
+    void testIntegerGeometry()
+    {
+        std::cout << "Running tests for integer geometry paths..." << std::endl;
+
+        // Fixed seeds for reproducibility
+        testIntegerType<std::int16_t>(57, 200);
+        testIntegerType<std::int32_t>(58, 200);
+
+        // Products of these coordinates need more than 53 bits, a double
+        // orientation test rounds the triangle's area to zero
+        const std::int32_t big = std::numeric_limits<std::int32_t>::max();
+        auto nearlyCollinear = NDArray<std::int32_t, 2>::Empty({3, 2});
+        nearlyCollinear(0, 0) = 0;
+        nearlyCollinear(0, 1) = 0;
+        nearlyCollinear(1, 0) = big - 1;
+        nearlyCollinear(1, 1) = big - 2;
+        nearlyCollinear(2, 0) = big;
+        nearlyCollinear(2, 1) = big - 1;
+
+        DEBUG_ONLY const auto hull = computeConvexHull(nearlyCollinear);
+        assert(hull.shape()[0] == 3 && "Exact orientation lost a hull vertex");
+        testIntegerInvariants(nearlyCollinear);
+
+        // A hull of repeated points has coincident vertices and no edge
+        // direction, both paths return a zero-size rectangle on the point
+        const auto repeated = []<typename T>(std::type_identity<T>, size_type count)
+        {
+            auto points = NDArray<T, 2>::Full({count, 2}, T{5});
+            DEBUG_ONLY const auto rectangle = minAreaRectangle(points);
+            assert(rectangle.center[0] == 5.0 && rectangle.center[1] == 5.0 &&
+                   rectangle.size[0] == 0.0 && rectangle.size[1] == 0.0 && rectangle.angle == 0.0 &&
+                   "Repeated points need a zero-size rectangle");
+        };
+        repeated(std::type_identity<std::int16_t>{}, 2);
+        repeated(std::type_identity<std::int32_t>{}, 3);
+        repeated(std::type_identity<double>{}, 4);
+
+        // Unsigned coordinates take a signed tolerance, -tolerance must
+        // not wrap around
+        auto triangle = NDArray<std::uint32_t, 2>::Empty({3, 2});
+        triangle(0, 0) = 0;
+        triangle(0, 1) = 0;
+        triangle(1, 0) = 4;
+        triangle(1, 1) = 0;
+        triangle(2, 0) = 0;
+        triangle(2, 1) = 4;
+        assert(Detail::insideConvex(triangle, 1u, 1u, 1) && !Detail::insideConvex(triangle, 5u, 5u, 1) &&
+               Detail::insideConvex(triangle, 3u, 2u, 4) && !Detail::insideConvex(triangle, 3u, 2u, 3) &&
+               "Wrong tolerance for unsigned coordinates");
     }
 
 }
@@ -0,0 +1,140 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Sparsh Jain
+ *
+ */
+
+#include <iostream>
+#include <random>
+
+#include <cpp_eigen_opencv/shared/ndarray.hpp>
+#include <cpp_eigen_opencv/shared/kdtree.hpp>
+#include <cpp_eigen_opencv/shared/debug.hpp>
+
+namespace Geometry
+{
+    namespace
+    {
+        double bruteDistanceSquared(
+            const NDArray<double, 2> &points,
+            size_type i,
+            const NDArray<const double, 1> &query)
+        {
+            double d2{0};
+            for (size_type d = 0; d < query.size(); ++d)
+            {
+                const double diff = points(i, d) - query[d];
+                d2 += diff * diff;
+            }
+            return d2;
+        }
+
+        void testKDTreeInvariants(
+            const NDArray<double, 2> &points,
+            const NDArray<double, 2> &queries)
+        {
+            const auto N = points.shape()[0];
+            const auto D = points.shape()[1];
+            const auto tree = KDTree<double>(points, 4);
+            constexpr size_type k = 5;
+            constexpr double radius = 150.0;
+
+            const auto batch = tree.knnBatch(queries, k);
+            const auto radiusBatch = tree.radiusSearchBatch(queries, radius);
+
+            for (size_type q = 0; q < queries.shape()[0]; ++q)
+            {
+                const auto query = NDArray<const double, 1>(&queries(q, 0), {D});
+
+                // k nearest distances match brute force
+                std::vector<double> distances(N);
+                for (size_type i = 0; i < N; ++i)
+                    distances[i] = bruteDistanceSquared(points, i, query);
+                std::sort(distances.begin(), distances.end());
+
+                const auto neighbors = tree.knn(query, k);
+                assert(neighbors.size() == std::min(k, N) && "Wrong neighbor count");
+                for (size_type j = 0; j < neighbors.size(); ++j)
+                {
+                    assert(neighbors[j].distanceSquared == distances[j] &&
+                           "Neighbor distance mismatch");
+                    assert(bruteDistanceSquared(points, neighbors[j].index, query) ==
+                               neighbors[j].distanceSquared &&
+                           "Neighbor index mismatch");
+                    assert(batch.indices(q, j) == neighbors[j].index &&
+                           "Batched knn mismatch");
+                }
+
+                // Radius search returns exactly the points within radius
+                auto inRadius = tree.radiusSearch(query, radius);
+                std::sort(inRadius.begin(), inRadius.end());
+                std::vector<size_type> expected;
+                for (size_type i = 0; i < N; ++i)
+                {
+                    if (bruteDistanceSquared(points, i, query) <= radius * radius)
+                        expected.push_back(i);
+                }
+                assert(inRadius == expected && "Radius search mismatch");
+
+                auto batchRadius = radiusBatch[q];
+                std::sort(batchRadius.begin(), batchRadius.end());
+                assert(batchRadius == expected && "Batched radius search mismatch");
+
+                // Box search returns exactly the points inside the box
+                auto lower = NDArray<double, 1>::Empty({D});
+                auto upper = NDArray<double, 1>::Empty({D});
+                for (size_type d = 0; d < D; ++d)
+                {
+                    lower[d] = query[d] - radius;
+                    upper[d] = query[d] + 0.5 * radius;
+                }
+
+                auto inBox = tree.boxSearch(lower, upper);
+                std::sort(inBox.begin(), inBox.end());
+                expected.clear();
+                for (size_type i = 0; i < N; ++i)
+                {
+                    bool inside = true;
+                    for (size_type d = 0; d < D; ++d)
+                        inside = inside && lower[d] <= points(i, d) && points(i, d) <= upper[d];
+                    if (inside)
+                        expected.push_back(i);
+                }
+                assert(inBox == expected && "Box search mismatch");
+            }
+        }
+    }
+
+    void testKDTree()
+    {
+        std::cout << "Running tests for KDTree..." << std::endl;
+
+        std::mt19937 rng(51); // Fixed seed for reproducibility
+        std::uniform_real_distribution<double> dist(-1000.0, 1000.0);
+
+        for (int iter = 0; iter < 100; ++iter)
+        {
+            const size_type numPoints = rng() % 2000;
+            const size_type D = 2 + static_cast<size_type>(iter % 2);
+            auto points = NDArray<double, 2>::Empty({numPoints, D});
+            auto queries = NDArray<double, 2>::Empty({16, D});
+
+            for (size_type i = 0; i < numPoints; ++i)
+            {
+                for (size_type d = 0; d < D; ++d)
+                    // Snap some coordinates to a coarse grid to get duplicates
+                    points(i, d) = (i % 3 == 0) ? std::round(dist(rng) / 100.0) * 100.0 : dist(rng);
+            }
+
+            for (size_type i = 0; i < queries.shape()[0]; ++i)
+            {
+                for (size_type d = 0; d < D; ++d)
+                    queries(i, d) = dist(rng);
+            }
+
+            testKDTreeInvariants(points, queries);
+        }
+    }
+
+}
@@ -0,0 +1,357 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Sparsh Jain
+ *
+ */
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <cpp_eigen_opencv/shared/kernels.hpp>
+#include <cpp_eigen_opencv/shared/debug.hpp>
+
+// One clone per ISA level plus the baseline the file is compiled for
+// The v3 and v4 clones may contract a * b + c into an FMA, so floating
+// results can differ from the baseline clone in the last bit, just like
+// -march=native builds on different hosts always did.
+#if defined(__x86_64__) && defined(__GNUC__) && !defined(__clang__) && !defined(ND_NO_MULTIVERSION)
+#define ND_MULTIVERSION [[gnu::target_clones("arch=x86-64-v4", "arch=x86-64-v3", "arch=x86-64-v2", "default")]]
+#define ND_MULTIVERSION_ENABLED 1
+#else
+#define ND_MULTIVERSION
+#endif
+
+namespace ND::Kernels
+{
+    namespace
+    {
+        template <typename T, typename Op>
+        inline void arrays(const T *a, const T *b, T *out, size_type n, Op op)
+        {
+            for (size_type i = 0; i < n; ++i)
+                out[i] = op(a[i], b[i]);
+        }
+
+        template <typename T, typename Op>
+        inline void arrayScalar(const T *a, T b, T *out, size_type n, Op op)
+        {
+            for (size_type i = 0; i < n; ++i)
+                out[i] = op(a[i], b);
+        }
+
+        template <typename T, typename Op>
+        inline void scalarArray(T a, const T *b, T *out, size_type n, Op op)
+        {
+            for (size_type i = 0; i < n; ++i)
+                out[i] = op(a, b[i]);
+        }
+
+        // Independent partial sums let the loop vectorize without
+        // reassociating a single running sum
+        template <typename T>
+        inline T dotProduct(const T *a, const T *b, size_type n)
+        {
+            if constexpr (std::is_integral_v<T>)
+            {
+                T result{0};
+                for (size_type i = 0; i < n; ++i)
+                    result += a[i] * b[i];
+                return result;
+            }
+            else
+            {
+                constexpr size_type Lanes = 8;
+                std::array<T, Lanes> partial{};
+                size_type i = 0;
+                for (; i + Lanes <= n; i += Lanes)
+                {
+                    for (size_type k = 0; k < Lanes; ++k)
+                        partial[k] += a[i + k] * b[i + k];
+                }
+                for (; i < n; ++i)
+                    partial[0] += a[i] * b[i];
+
+                T result{0};
+                for (const auto value : partial)
+                    result += value;
+                return result;
+            }
+        }
+
+        template <typename T>
+        inline void bounds(const T *xy, size_type n, double ux, double uy, double out[4])
+        {
+            double minX = std::numeric_limits<double>::infinity();
+            double maxX = -minX;
+            double minY = minX;
+            double maxY = maxX;
+            for (size_type j = 0; j < n; ++j)
+            {
+                const auto x = static_cast<double>(xy[2 * j]);
+                const auto y = static_cast<double>(xy[2 * j + 1]);
+                const double projX = x * ux + y * uy;
+                const double projY = x * -uy + y * ux;
+                minX = std::min(minX, projX);
+                maxX = std::max(maxX, projX);
+                minY = std::min(minY, projY);
+                maxY = std::max(maxY, projY);
+            }
+            out[0] = minX;
+            out[1] = maxX;
+            out[2] = minY;
+            out[3] = maxY;
+        }
+    }
+
+#define ND_DEFINE_ELEMENTWISE_KERNELS(T)                                                                                         \
+    ND_MULTIVERSION void add(const T *a, const T *b, T *out, size_type n) { arrays(a, b, out, n, std::plus<T>{}); }              \
+    ND_MULTIVERSION void subtract(const T *a, const T *b, T *out, size_type n) { arrays(a, b, out, n, std::minus<T>{}); }        \
+    ND_MULTIVERSION void multiply(const T *a, const T *b, T *out, size_type n) { arrays(a, b, out, n, std::multiplies<T>{}); }   \
+    ND_MULTIVERSION void divide(const T *a, const T *b, T *out, size_type n) { arrays(a, b, out, n, std::divides<T>{}); }        \
+    ND_MULTIVERSION void add(const T *a, T b, T *out, size_type n) { arrayScalar(a, b, out, n, std::plus<T>{}); }                \
+    ND_MULTIVERSION void subtract(const T *a, T b, T *out, size_type n) { arrayScalar(a, b, out, n, std::minus<T>{}); }          \
+    ND_MULTIVERSION void multiply(const T *a, T b, T *out, size_type n) { arrayScalar(a, b, out, n, std::multiplies<T>{}); }     \
+    ND_MULTIVERSION void divide(const T *a, T b, T *out, size_type n) { arrayScalar(a, b, out, n, std::divides<T>{}); }          \
+    ND_MULTIVERSION void add(T a, const T *b, T *out, size_type n) { scalarArray(a, b, out, n, std::plus<T>{}); }                \
+    ND_MULTIVERSION void subtract(T a, const T *b, T *out, size_type n) { scalarArray(a, b, out, n, std::minus<T>{}); }          \
+    ND_MULTIVERSION void multiply(T a, const T *b, T *out, size_type n) { scalarArray(a, b, out, n, std::multiplies<T>{}); }     \
+    ND_MULTIVERSION void divide(T a, const T *b, T *out, size_type n) { scalarArray(a, b, out, n, std::divides<T>{}); }          \
+    ND_MULTIVERSION T dot(const T *a, const T *b, size_type n) { return dotProduct(a, b, n); }
+
+    ND_DEFINE_ELEMENTWISE_KERNELS(float)
+    ND_DEFINE_ELEMENTWISE_KERNELS(double)
+    ND_DEFINE_ELEMENTWISE_KERNELS(std::int32_t)
+
+#undef ND_DEFINE_ELEMENTWISE_KERNELS
+
+    // Conversions from or to double compute in double, the others in float
+    template <typename A, typename B>
+    using ConvertAcc = std::conditional_t<std::is_same_v<A, double> || std::is_same_v<B, double>, double, float>;
+
+#define ND_DEFINE_CONVERT_KERNELS(A, B)                                                                                     \
+    ND_MULTIVERSION void convert(const A *in, B *out, size_type n, double scale, double offset, Rounding rounding) \
+    {                                                                                                               \
+        convertArray<ConvertAcc<A, B>>(in, out, n, scale, offset, rounding);                                        \
+    }                                                                                                               \
+    ND_MULTIVERSION void convert(const B *in, A *out, size_type n, double scale, double offset, Rounding rounding) \
+    {                                                                                                               \
+        convertArray<ConvertAcc<A, B>>(in, out, n, scale, offset, rounding);                                        \
+    }
+
+    ND_DEFINE_CONVERT_KERNELS(std::uint8_t, float)
+    ND_DEFINE_CONVERT_KERNELS(std::int16_t, float)
+    ND_DEFINE_CONVERT_KERNELS(std::uint8_t, double)
+    ND_DEFINE_CONVERT_KERNELS(float, double)
+
+#undef ND_DEFINE_CONVERT_KERNELS
+
+    ND_MULTIVERSION void projectionBounds(const float *xy, size_type n, double ux, double uy, double out[4])
+    {
+        bounds(xy, n, ux, uy, out);
+    }
+
+    ND_MULTIVERSION void projectionBounds(const double *xy, size_type n, double ux, double uy, double out[4])
+    {
+        bounds(xy, n, ux, uy, out);
+    }
+
+    ND_MULTIVERSION void pixelPowerSums(const std::uint8_t *row, size_type n, bool binary, std::int64_t sums[4])
+    {
+        // i^3 * 255 summed over 64 pixels stays below 2^31, so the
+        // lanes can stay 32-bit
+        std::int32_t t0 = 0, t1 = 0, t2 = 0, t3 = 0;
+        for (size_type i = 0; i < n; ++i)
+        {
+            const std::int32_t w = binary ? static_cast<std::int32_t>(row[i] != 0) : static_cast<std::int32_t>(row[i]);
+            const auto xi = static_cast<std::int32_t>(i);
+            t0 += w;
+            t1 += w * xi;
+            t2 += w * xi * xi;
+            t3 += w * xi * xi * xi;
+        }
+        sums[0] = t0;
+        sums[1] = t1;
+        sums[2] = t2;
+        sums[3] = t3;
+    }
+
+    const char *isaLevel()
+    {
+#ifdef ND_MULTIVERSION_ENABLED
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("x86-64-v4"))
+            return "x86-64-v4";
+        if (__builtin_cpu_supports("x86-64-v3"))
+            return "x86-64-v3";
+        if (__builtin_cpu_supports("x86-64-v2"))
+            return "x86-64-v2";
+#endif
+        return "default";
+    }
+
+    /**************************************************************************/
+
+    namespace
+    {
+        template <typename T>
+        void testElementType(std::mt19937 &rng)
+        {
+            std::uniform_int_distribution<int> value(1, 100);
+            for (size_type n : {size_type{0}, size_type{1}, size_type{7}, size_type{33}, size_type{1000}})
+            {
+                std::vector<T> a(n), b(n), out(n);
+                for (size_type i = 0; i < n; ++i)
+                {
+                    a[i] = static_cast<T>(value(rng));
+                    b[i] = static_cast<T>(value(rng));
+                }
+
+                const auto check = [&](auto op, auto kernel)
+                {
+                    kernel();
+                    DEBUG_ONLY bool same = true;
+                    for (size_type i = 0; i < n; ++i)
+                        same = same && out[i] == op(i);
+                    assert(same && "Kernel differs from the scalar loop");
+                };
+
+                check([&](size_type i)
+                      { return static_cast<T>(a[i] + b[i]); }, [&]()
+                      { add(a.data(), b.data(), out.data(), n); });
+                check([&](size_type i)
+                      { return static_cast<T>(a[i] - b[i]); }, [&]()
+                      { subtract(a.data(), b.data(), out.data(), n); });
+                check([&](size_type i)
+                      { return static_cast<T>(a[i] * b[i]); }, [&]()
+                      { multiply(a.data(), b.data(), out.data(), n); });
+                check([&](size_type i)
+                      { return static_cast<T>(a[i] / b[i]); }, [&]()
+                      { divide(a.data(), b.data(), out.data(), n); });
+                check([&](size_type i)
+                      { return static_cast<T>(a[i] * T{3}); }, [&]()
+                      { multiply(a.data(), T{3}, out.data(), n); });
+                check([&](size_type i)
+                      { return static_cast<T>(T{3} - b[i]); }, [&]()
+                      { subtract(T{3}, b.data(), out.data(), n); });
+
+                // Small integers, so every partial sum is exact
+                T expected{0};
+                for (size_type i = 0; i < n; ++i)
+                    expected += a[i] * b[i];
+                DEBUG_ONLY const auto result = dot(a.data(), b.data(), n);
+                assert(result == expected && "dot kernel differs from the scalar loop");
+            }
+        }
+
+        template <typename T>
+        void testProjectionBounds(std::mt19937 &rng)
+        {
+            std::uniform_real_distribution<double> coordinate(-10.0, 10.0);
+            std::vector<T> xy(2 * 37);
+            for (auto &v : xy)
+                v = static_cast<T>(coordinate(rng));
+
+            const double angle = coordinate(rng);
+            const double ux = std::cos(angle), uy = std::sin(angle);
+            double out[4];
+            projectionBounds(xy.data(), xy.size() / 2, ux, uy, out);
+
+            double expected[4] = {std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(),
+                                  std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity()};
+            for (size_type j = 0; j < xy.size() / 2; ++j)
+            {
+                const auto x = static_cast<double>(xy[2 * j]), y = static_cast<double>(xy[2 * j + 1]);
+                expected[0] = std::min(expected[0], x * ux + y * uy);
+                expected[1] = std::max(expected[1], x * ux + y * uy);
+                expected[2] = std::min(expected[2], x * -uy + y * ux);
+                expected[3] = std::max(expected[3], x * -uy + y * ux);
+            }
+            for (int k = 0; k < 4; ++k)
+                assert(std::abs(out[k] - expected[k]) <= 1e-10 && "projectionBounds differs from the scalar loop");
+        }
+
+        // Each kernel against the scalar convertValue, with a scale and
+        // offset that keep the arithmetic exact so FMA clones agree
+        template <typename From, typename To>
+        void testConvert(std::mt19937 &rng)
+        {
+            std::uniform_int_distribution<int> value(-600, 600);
+            std::vector<From> in(77);
+            for (auto &v : in)
+            {
+                const double x = 0.5 * value(rng);
+                if constexpr (std::is_integral_v<From>)
+                    v = static_cast<From>(std::clamp<double>(x, std::numeric_limits<From>::lowest(),
+                                                             std::numeric_limits<From>::max()));
+                else
+                    v = static_cast<From>(x);
+            }
+
+            std::vector<To> out(in.size());
+            const auto check = [&]<Rounding Mode>(std::integral_constant<Rounding, Mode>)
+            {
+                using Acc = ConvertAcc<From, To>;
+                convert(in.data(), out.data(), in.size(), 0.5, 0.25, Mode);
+                DEBUG_ONLY bool same = true;
+                for (size_type i = 0; i < in.size(); ++i)
+                    same = same && out[i] == convertValue<Mode, To, Acc>(in[i], Acc{0.5}, Acc{0.25});
+                assert(same && "convert kernel differs from convertValue");
+            };
+            check(std::integral_constant<Rounding, Rounding::Nearest>{});
+            check(std::integral_constant<Rounding, Rounding::Truncate>{});
+            check(std::integral_constant<Rounding, Rounding::Floor>{});
+            check(std::integral_constant<Rounding, Rounding::Ceil>{});
+        }
+    }
+
+    void testKernels()
+    {
+        std::cout << "Running tests for kernels (" << isaLevel() << ")..." << std::endl;
+
+        std::mt19937 rng(67);
+        testElementType<float>(rng);
+        testElementType<double>(rng);
+        testElementType<std::int32_t>(rng);
+        testProjectionBounds<float>(rng);
+        testProjectionBounds<double>(rng);
+        testConvert<std::uint8_t, float>(rng);
+        testConvert<float, std::uint8_t>(rng);
+        testConvert<std::int16_t, float>(rng);
+        testConvert<float, std::int16_t>(rng);
+        testConvert<std::uint8_t, double>(rng);
+        testConvert<double, std::uint8_t>(rng);
+        testConvert<float, double>(rng);
+        testConvert<double, float>(rng);
+
+        std::uniform_int_distribution<int> pixel(0, 255);
+        std::vector<std::uint8_t> row(64);
+        for (auto &p : row)
+            p = static_cast<std::uint8_t>(pixel(rng));
+        row[5] = 0;
+        for (const bool binary : {false, true})
+        {
+            std::int64_t sums[4];
+            pixelPowerSums(row.data(), row.size(), binary, sums);
+            std::int64_t expected[4] = {};
+            for (std::int64_t i = 0; i < 64; ++i)
+            {
+                const std::int64_t w = binary ? (row[static_cast<size_type>(i)] != 0) : row[static_cast<size_type>(i)];
+                expected[0] += w;
+                expected[1] += w * i;
+                expected[2] += w * i * i;
+                expected[3] += w * i * i * i;
+            }
+            for (int k = 0; k < 4; ++k)
+                assert(sums[k] == expected[k] && "pixelPowerSums differs from the scalar loop");
+        }
+    }
+
+} // namespace ND::Kernels
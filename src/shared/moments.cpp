@@ -0,0 +1,354 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Sparsh Jain
+ *
+ */
+
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+
+#include <cpp_eigen_opencv/shared/ndarray.hpp>
+#include <cpp_eigen_opencv/shared/geometry.hpp>
+#include <cpp_eigen_opencv/shared/moments.hpp>
+#include <cpp_eigen_opencv/shared/debug.hpp>
+
+namespace Geometry
+{
+    namespace Detail
+    {
+        Moments completeMoments(const SpatialSums &spatial)
+        {
+            Moments m{};
+            m.m00 = spatial[0];
+            m.m10 = spatial[1];
+            m.m01 = spatial[2];
+            m.m20 = spatial[3];
+            m.m11 = spatial[4];
+            m.m02 = spatial[5];
+            m.m30 = spatial[6];
+            m.m21 = spatial[7];
+            m.m12 = spatial[8];
+            m.m03 = spatial[9];
+
+            const double inverseM00 = (m.m00 != 0.0) ? 1.0 / m.m00 : 0.0;
+            const double cx = m.m10 * inverseM00;
+            const double cy = m.m01 * inverseM00;
+
+            // Central moments from spatial ones, same expansion as OpenCV
+            m.mu20 = m.m20 - m.m10 * cx;
+            m.mu11 = m.m11 - m.m10 * cy;
+            m.mu02 = m.m02 - m.m01 * cy;
+            m.mu30 = m.m30 - cx * (3.0 * m.mu20 + cx * m.m10);
+            m.mu21 = m.m21 - cx * (2.0 * m.mu11 + cx * m.m01) - cy * m.mu20;
+            m.mu12 = m.m12 - cy * (2.0 * m.mu11 + cy * m.m10) - cx * m.mu02;
+            m.mu03 = m.m03 - cy * (3.0 * m.mu02 + cy * m.m01);
+
+            const double s2 = inverseM00 * inverseM00;
+            const double s3 = s2 * std::sqrt(std::abs(inverseM00));
+            m.nu20 = m.mu20 * s2;
+            m.nu11 = m.mu11 * s2;
+            m.nu02 = m.mu02 * s2;
+            m.nu30 = m.mu30 * s3;
+            m.nu21 = m.mu21 * s3;
+            m.nu12 = m.mu12 * s3;
+            m.nu03 = m.mu03 * s3;
+
+            return m;
+        }
+
+        Moments contourMoments(const SpatialSums &edgeSums)
+        {
+            // Same cut-off as OpenCV for contours without area
+            if (std::abs(edgeSums[0]) <= static_cast<double>(std::numeric_limits<float>::epsilon()))
+                return Moments{};
+
+            // Clockwise contours have negative sums
+            const double sign = (edgeSums[0] > 0.0) ? 1.0 : -1.0;
+            constexpr SpatialSums scale = {
+                1.0 / 2.0, 1.0 / 6.0, 1.0 / 6.0, 1.0 / 12.0, 1.0 / 24.0,
+                1.0 / 12.0, 1.0 / 20.0, 1.0 / 60.0, 1.0 / 60.0, 1.0 / 20.0};
+
+            SpatialSums spatial{};
+            for (size_type k = 0; k < spatial.size(); ++k)
+                spatial[k] = sign * scale[k] * edgeSums[k];
+
+            return completeMoments(spatial);
+        }
+    }
+
+    std::array<double, 7> huMoments(const Moments &m)
+    {
+        std::array<double, 7> hu{};
+
+        double t0 = m.nu30 + m.nu12;
+        double t1 = m.nu21 + m.nu03;
+        double q0 = t0 * t0;
+        double q1 = t1 * t1;
+        const double n4 = 4.0 * m.nu11;
+        const double s = m.nu20 + m.nu02;
+        const double d = m.nu20 - m.nu02;
+
+        hu[0] = s;
+        hu[1] = d * d + n4 * m.nu11;
+        hu[3] = q0 + q1;
+        hu[5] = d * (q0 - q1) + n4 * t0 * t1;
+
+        t0 *= q0 - 3.0 * q1;
+        t1 *= 3.0 * q0 - q1;
+
+        q0 = m.nu30 - 3.0 * m.nu12;
+        q1 = 3.0 * m.nu21 - m.nu03;
+
+        hu[2] = q0 * q0 + q1 * q1;
+        hu[4] = q0 * t0 + q1 * t1;
+        hu[6] = q1 * t0 - q0 * t1;
+
+        return hu;
+    }
+
+    /**************************************************************************/
+
+    namespace
+    {
+        constexpr double relativeEps = 1e-9;
+
+        bool close(double a, double b, double scale)
+        {
+            return std::abs(a - b) <= relativeEps * (1.0 + scale);
+        }
+
+        // Compares every field, scaled by the magnitude of each group
+        DEBUG_ONLY bool closeMoments(const Moments &a, const Moments &b)
+        {
+            const double spatial = std::max({std::abs(b.m00), std::abs(b.m30), std::abs(b.m03),
+                                             std::abs(b.m21), std::abs(b.m12)});
+            const double central = std::max({std::abs(b.mu20), std::abs(b.mu02), std::abs(b.mu30),
+                                             std::abs(b.mu03), std::abs(b.mu21), std::abs(b.mu12)});
+            const double normalized = std::max({std::abs(b.nu20), std::abs(b.nu02), std::abs(b.nu30),
+                                                std::abs(b.nu03), std::abs(b.nu21), std::abs(b.nu12)});
+
+            return close(a.m00, b.m00, spatial) && close(a.m10, b.m10, spatial) &&
+                   close(a.m01, b.m01, spatial) && close(a.m20, b.m20, spatial) &&
+                   close(a.m11, b.m11, spatial) && close(a.m02, b.m02, spatial) &&
+                   close(a.m30, b.m30, spatial) && close(a.m21, b.m21, spatial) &&
+                   close(a.m12, b.m12, spatial) && close(a.m03, b.m03, spatial) &&
+                   close(a.mu20, b.mu20, central) && close(a.mu11, b.mu11, central) &&
+                   close(a.mu02, b.mu02, central) && close(a.mu30, b.mu30, central) &&
+                   close(a.mu21, b.mu21, central) && close(a.mu12, b.mu12, central) &&
+                   close(a.mu03, b.mu03, central) &&
+                   close(a.nu20, b.nu20, normalized) && close(a.nu11, b.nu11, normalized) &&
+                   close(a.nu02, b.nu02, normalized) && close(a.nu30, b.nu30, normalized) &&
+                   close(a.nu21, b.nu21, normalized) && close(a.nu12, b.nu12, normalized) &&
+                   close(a.nu03, b.nu03, normalized);
+        }
+
+        // Per pixel reference for imageMoments
+        template <Arithmetic T>
+        Moments bruteForceImageMoments(const NDArray<T, 2> &image, bool binary)
+        {
+            Detail::SpatialSums sums{};
+            for (size_type y = 0; y < image.shape()[0]; ++y)
+            {
+                for (size_type x = 0; x < image.shape()[1]; ++x)
+                {
+                    const double w = binary ? (image(y, x) != T{} ? 1.0 : 0.0)
+                                            : static_cast<double>(image(y, x));
+                    const double X = static_cast<double>(x);
+                    const double Y = static_cast<double>(y);
+                    const Detail::SpatialSums pixel = {
+                        w, w * X, w * Y, w * X * X, w * X * Y, w * Y * Y,
+                        w * X * X * X, w * X * X * Y, w * X * Y * Y, w * Y * Y * Y};
+                    Detail::addSums(sums, pixel);
+                }
+            }
+            return Detail::completeMoments(sums);
+        }
+
+        template <Arithmetic T>
+        void testImageMoments(std::mt19937 &rng, T low, T high)
+        {
+            using Distribution = std::conditional_t<std::is_floating_point_v<T>,
+                                                    std::uniform_real_distribution<T>,
+                                                    std::uniform_int_distribution<int>>;
+            Distribution values(low, high);
+            std::bernoulli_distribution on(0.3);
+
+            for (int iter = 0; iter < 20; ++iter)
+            {
+                // Widths around the block size
+                const size_type rows = rng() % 150 + 1;
+                const size_type cols = rng() % 150 + 1;
+                auto image = NDArray<T, 2>::Zeros({rows, cols});
+                for (size_type y = 0; y < rows; ++y)
+                {
+                    for (size_type x = 0; x < cols; ++x)
+                    {
+                        if (on(rng))
+                            image(y, x) = static_cast<T>(values(rng));
+                    }
+                }
+
+                for (const bool binary : {false, true})
+                {
+                    DEBUG_ONLY const auto result = imageMoments(image, binary);
+                    DEBUG_ONLY const auto expected = bruteForceImageMoments(image, binary);
+                    assert(closeMoments(result, expected) && "imageMoments mismatch");
+                }
+            }
+        }
+    }
+
+    void testMoments()
+    {
+        std::cout << "Running tests for moments..." << std::endl;
+
+        std::mt19937 rng(58); // Fixed seed for reproducibility
+        std::uniform_real_distribution<double> dist(-100.0, 100.0);
+        std::uniform_real_distribution<double> angleDist(0.0, 2.0 * pi);
+
+        // Closed form moments of an axis aligned a x b rectangle at the origin
+        {
+            const double a = 3.0, b = 5.0;
+            auto rectangle = NDArray<double, 2>::Empty({4, 2});
+            rectangle(0, 0) = 0.0;
+            rectangle(0, 1) = 0.0;
+            rectangle(1, 0) = a;
+            rectangle(1, 1) = 0.0;
+            rectangle(2, 0) = a;
+            rectangle(2, 1) = b;
+            rectangle(3, 0) = 0.0;
+            rectangle(3, 1) = b;
+
+            DEBUG_ONLY const auto m = polygonMoments(rectangle);
+            DEBUG_ONLY const double s = std::pow(a, 4) * std::pow(b, 4);
+            assert(close(m.m00, a * b, s) && close(m.m10, a * a * b / 2.0, s) &&
+                   close(m.m01, a * b * b / 2.0, s) && close(m.m20, a * a * a * b / 3.0, s) &&
+                   close(m.m11, a * a * b * b / 4.0, s) && close(m.m02, a * b * b * b / 3.0, s) &&
+                   close(m.m30, std::pow(a, 4) * b / 4.0, s) && close(m.m21, a * a * a * b * b / 6.0, s) &&
+                   close(m.m12, a * a * b * b * b / 6.0, s) && close(m.m03, a * std::pow(b, 4) / 4.0, s) &&
+                   "Rectangle moments mismatch");
+            assert(close(m.mu20, a * a * a * b / 12.0, s) && close(m.mu11, 0.0, s) &&
+                   close(m.mu30, 0.0, s) && "Rectangle central moments mismatch");
+
+            // Clockwise order gives the same moments
+            auto reversed = NDArray<double, 2>::Empty({4, 2});
+            for (size_type i = 0; i < 4; ++i)
+            {
+                reversed(i, 0) = rectangle(3 - i, 0);
+                reversed(i, 1) = rectangle(3 - i, 1);
+            }
+            assert(closeMoments(polygonMoments(reversed), m) && "Contour orientation changed moments");
+
+            // The mask of the pixel grid [0, 4) x [0, 6) has the same
+            // central moments as a 4 x 6 box of unit masses
+            auto mask = NDArray<std::uint8_t, 2>::Zeros({8, 9});
+            auto grid = NDArray<int, 2>::Empty({24, 2});
+            for (size_type y = 0; y < 6; ++y)
+            {
+                for (size_type x = 0; x < 4; ++x)
+                {
+                    mask(y + 1, x + 2) = 255;
+                    grid(y * 4 + x, 0) = static_cast<int>(x + 2);
+                    grid(y * 4 + x, 1) = static_cast<int>(y + 1);
+                }
+            }
+            assert(closeMoments(imageMoments(mask, true), pointMoments(grid)) &&
+                   "Mask moments do not match point moments");
+        }
+
+        // Hu moments are invariant to rotation, translation and scale,
+        // contours of random star shaped polygons
+        for (int iter = 0; iter < 200; ++iter)
+        {
+            const size_type N = rng() % 40 + 3;
+            auto polygon = NDArray<double, 2>::Empty({N, 2});
+            for (size_type i = 0; i < N; ++i)
+            {
+                const double angle = 2.0 * pi * static_cast<double>(i) / static_cast<double>(N);
+                const double radius = 10.0 + std::abs(dist(rng));
+                polygon(i, 0) = radius * std::cos(angle);
+                polygon(i, 1) = radius * std::sin(angle);
+            }
+
+            const double theta = angleDist(rng);
+            const double scale = 0.5 + std::abs(dist(rng)) / 50.0;
+            const double tx = dist(rng), ty = dist(rng);
+            auto transformed = NDArray<double, 2>::Empty({N, 2});
+            for (size_type i = 0; i < N; ++i)
+            {
+                const double x = polygon(i, 0), y = polygon(i, 1);
+                transformed(i, 0) = scale * (std::cos(theta) * x - std::sin(theta) * y) + tx;
+                transformed(i, 1) = scale * (std::sin(theta) * x + std::cos(theta) * y) + ty;
+            }
+
+            const auto m = polygonMoments(polygon);
+            const auto mt = polygonMoments(transformed);
+            assert(close(mt.m00, scale * scale * m.m00, mt.m00) && "Area does not scale");
+
+            DEBUG_ONLY const auto hu = huMoments(m);
+            DEBUG_ONLY const auto huTransformed = huMoments(mt);
+            for (size_type k = 0; k < hu.size(); ++k)
+                assert(std::abs(hu[k] - huTransformed[k]) <= 1e-7 * (std::abs(hu[k]) + 1e-6) &&
+                       "Hu moments not invariant");
+        }
+
+        // Point moments and the batch API match single calls
+        for (int iter = 0; iter < 50; ++iter)
+        {
+            const size_type C = rng() % 20 + 1;
+            std::vector<size_type> offsets{0};
+            std::vector<NDArray<float, 2>> contours;
+            for (size_type c = 0; c < C; ++c)
+            {
+                const size_type n = rng() % 30;
+                auto contour = NDArray<float, 2>::Empty({n, 2});
+                for (size_type i = 0; i < n; ++i)
+                {
+                    contour(i, 0) = static_cast<float>(dist(rng));
+                    contour(i, 1) = static_cast<float>(dist(rng));
+                }
+                contours.push_back(contour);
+                offsets.push_back(offsets.back() + n);
+            }
+
+            auto points = NDArray<float, 2>::Empty({offsets.back(), 2});
+            for (size_type c = 0; c < C; ++c)
+            {
+                for (size_type i = 0; i < contours[c].shape()[0]; ++i)
+                {
+                    points(offsets[c] + i, 0) = contours[c](i, 0);
+                    points(offsets[c] + i, 1) = contours[c](i, 1);
+                }
+            }
+
+            DEBUG_ONLY const auto batch = polygonMomentsBatch(points, offsets);
+            DEBUG_ONLY const auto batchContours = polygonMomentsBatch(contours);
+            for (size_type c = 0; c < C; ++c)
+            {
+                DEBUG_ONLY const auto single = polygonMoments(contours[c]);
+                assert(closeMoments(batch[c], single) && closeMoments(batchContours[c], single) &&
+                       "Batch moments mismatch");
+            }
+
+            Detail::SpatialSums sums{};
+            for (size_type i = 0; i < points.shape()[0]; ++i)
+            {
+                const double x = points(i, 0), y = points(i, 1);
+                const Detail::SpatialSums point = {
+                    1.0, x, y, x * x, x * y, y * y, x * x * x, x * x * y, x * y * y, y * y * y};
+                Detail::addSums(sums, point);
+            }
+            assert(closeMoments(pointMoments(points), Detail::completeMoments(sums)) &&
+                   "pointMoments mismatch");
+        }
+
+        // Image moments match per pixel sums for several pixel types
+        testImageMoments<std::uint8_t>(rng, 0, 255);
+        testImageMoments<std::int16_t>(rng, -32768, 32767);
+        testImageMoments<float>(rng, -1.0f, 1.0f);
+    }
+
+} // namespace Geometry
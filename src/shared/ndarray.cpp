@@ -5,10 +5,16 @@
  *
  */
 
+#include <cassert>
+#include <cmath>
+#include <cstdint>
 #include <iostream>
 #include <array>
+#include <utility>
+#include <vector>
 
 #include <cpp_eigen_opencv/shared/ndarray.hpp>
+#include <cpp_eigen_opencv/shared/debug.hpp>
 
 namespace ND
 {
@@ -51,6 +57,184 @@ namespace ND
             array(0, 0) = 100;
             std::cout << "Array(0, 0): " << array(0, 0) << std::endl;
         }
+
+        {
+            // Copy-on-write NDArray
+            auto array = NDArray<int, 2>::Zeros({3, 4}).CopyOnWrite();
+            assert(!array.IsShared() && "Fresh copy-on-write array is shared");
+
+            // Writing to the only holder stays in place
+            DEBUG_ONLY const int *buffer = std::as_const(array).data();
+            array(0, 0) = 1;
+            assert(std::as_const(array).data() == buffer && "Unshared array copied on write");
+
+            // Copies share until one writes, the writer gets its own buffer
+            auto copy = array;
+            assert(copy.IsShared() && std::as_const(copy).data() == buffer && "Copy did not share the buffer");
+            assert(std::as_const(copy)(0, 0) == 1 && std::as_const(array).IsShared() && "Const read detached");
+            copy(1, 1) = 2;
+            assert(std::as_const(copy).data() != buffer && !copy.IsShared() && !array.IsShared() &&
+                   "Shared array written in place");
+            assert(array(1, 1) == 0 && copy(1, 1) == 2 && copy(0, 0) == 1 && "Copy-on-write lost a value");
+            std::cout << "Copy-on-write: " << array(1, 1) << " " << copy(1, 1) << std::endl;
+
+            // Mutable() detaches once and hands out the plain array
+            auto shared = copy;
+            auto &rows = shared.Mutable();
+            rows(2, 3) = 3;
+            assert(!shared.IsShared() && copy(2, 3) == 0 && rows(2, 3) == 3 && "Mutable() did not detach");
+
+            // Plain arrays keep sharing writes
+            auto plain = NDArray<int, 1>::Zeros({2});
+            auto alias = plain;
+            alias[0] = 5;
+            assert(plain[0] == 5 && "Plain copies no longer share writes");
+        }
+
+        {
+            // Reshape and transpose views
+            auto matrix = NDArray<int, 2>::Empty({37, 53});
+            for (size_type i = 0; i < matrix.size(); ++i)
+                matrix[i] = static_cast<int>(i);
+
+            DEBUG_ONLY const auto flat = matrix.Reshape(Shape<1>{matrix.size()});
+            assert(flat.data() == std::as_const(matrix).data() && flat[100] == 100 && "Reshape copied");
+
+            const auto transposed = matrix.Transpose();
+            assert((transposed.shape() == Shape<2>{53, 37}) && !transposed.IsContiguous() &&
+                   transposed.data() == std::as_const(matrix).data() && "Transpose is not a view");
+
+            // Blocked copy of the view, and operators on it
+            const auto copy = transposed.Copy();
+            const auto sum = transposed + transposed.Copy();
+            DEBUG_ONLY bool same = copy.IsContiguous();
+            for (size_type i = 0; i < 53; ++i)
+            {
+                for (size_type j = 0; j < 37; ++j)
+                {
+                    same = same && copy(i, j) == matrix(j, i) && transposed(i, j) == matrix(j, i) &&
+                           sum(i, j) == 2 * matrix(j, i);
+                }
+            }
+            assert(same && "Transposed copy differs");
+            assert(transposed.Transpose().IsContiguous() && "Transposing twice is not the original");
+
+            // Reshaping a strided view copies it in row-major order
+            DEBUG_ONLY const auto rows = transposed.Reshape(Shape<1>{matrix.size()});
+            assert(rows.data() != transposed.data() && rows[1] == matrix(1, 0) && "Strided reshape order");
+
+            // Permuting three axes, copy-on-write views detach contiguously
+            auto cube = NDArray<int, 3>::Empty({2, 3, 4});
+            for (size_type i = 0; i < cube.size(); ++i)
+                cube[i] = static_cast<int>(i);
+
+            auto permuted = cube.CopyOnWrite().Permute({2, 0, 1});
+            assert((permuted.shape() == Shape<3>{4, 2, 3}) && std::as_const(permuted)(3, 1, 2) == cube(1, 2, 3) &&
+                   "Permute moved the wrong axes");
+            permuted(0, 0, 0) = -1;
+            assert(permuted.IsContiguous() && cube(0, 0, 0) == 0 && permuted(3, 1, 2) == cube(1, 2, 3) &&
+                   "Copy-on-write view detached wrong");
+
+            DEBUG_ONLY const auto swapped = cube.SwapAxes(0, 2);
+            assert((swapped.shape() == Shape<3>{4, 3, 2}) && swapped(3, 2, 1) == cube(1, 2, 3) && "SwapAxes");
+            assert(swapped.Copy()(1, 2, 0) == cube(0, 2, 1) && "Strided 3D copy");
+            std::cout << "Transpose(1, 0): " << transposed(1, 0) << std::endl;
+        }
+
+        {
+            // Conversion with rounding and saturation
+            const auto values = NDArray<double, 1>({-1.5, -0.5, 0.5, 1.5, 2.5, 254.6, 300.0, std::nan("")});
+            const auto nearest = values.AsType<std::uint8_t>();
+            const auto truncated = values.AsType<std::int16_t>(Rounding::Truncate);
+            const auto floored = values.AsType<std::int32_t>(Rounding::Floor);
+            const std::uint8_t expectedNearest[8] = {0, 0, 0, 2, 2, 255, 255, 0};
+            const std::int16_t expectedTruncated[7] = {-1, 0, 0, 1, 2, 254, 300};
+            const std::int32_t expectedFloored[7] = {-2, -1, 0, 1, 2, 254, 300};
+            DEBUG_ONLY bool same = true;
+            for (size_type i = 0; i < 7; ++i)
+            {
+                same = same && nearest[i] == expectedNearest[i] && truncated[i] == expectedTruncated[i] &&
+                       floored[i] == expectedFloored[i];
+            }
+            assert(same && nearest[7] == 0 && "Wrong rounding or saturation");
+
+            // Fused scale and offset, kernels and the generic loop agree
+            const auto image = NDArray<std::uint8_t, 2>::Full({3, 5}, 51);
+            DEBUG_ONLY const auto normalized = image.AsType<float>(1.0 / 255.0, -0.5);
+            DEBUG_ONLY const auto wide = image.AsType<std::int64_t>(1.0 / 255.0, -0.5);
+            assert(std::abs(normalized(2, 4) + 0.3f) < 1e-6f && wide(2, 4) == 0 && "Wrong scaled conversion");
+            assert(normalized.AsType<std::uint8_t>(255.0, 127.5)(1, 1) == 51 && "Round trip through float");
+
+            // 64-bit integers stay exact, views convert in logical order
+            DEBUG_ONLY const auto big = NDArray<std::int64_t, 1>({(std::int64_t{1} << 62) + 1, -5});
+            assert(big.AsType<std::int64_t>()[0] == big[0] && big.AsType<std::uint32_t>()[1] == 0 && "Integer saturation");
+            assert(image.Transpose().AsType<double>().shape()[0] == 5 && "Strided conversion");
+            std::cout << "AsType<std::uint8_t>(2.5): " << static_cast<int>(nearest[4]) << std::endl;
+        }
+
+        {
+            // Gather, scatter, masks and where
+            auto points = NDArray<int, 2>::Empty({40, 2});
+            for (size_type i = 0; i < points.size(); ++i)
+                points[i] = static_cast<int>(i);
+
+            // A repeated row, too small for the prefetch path
+            std::vector<size_type> order(40);
+            for (size_type k = 0; k < order.size(); ++k)
+                order[k] = (k * 7) % 40;
+            order[39] = order[0];
+
+            const auto taken = take(points, order);
+            const auto column = take(points.Transpose(), NDArray<int, 1>({1}));
+            DEBUG_ONLY bool same = (taken.shape() == Shape<2>{40, 2}) && (column.shape() == Shape<2>{1, 40});
+            for (size_type k = 0; k < order.size(); ++k)
+            {
+                same = same && taken(k, 0) == points(order[k], 0) && taken(k, 1) == points(order[k], 1) &&
+                       column(0, k) == points(k, 1);
+            }
+            assert(same && "Wrong take");
+
+            // Scattering a permutation back restores the rows
+            std::vector<size_type> permutation(40);
+            for (size_type k = 0; k < permutation.size(); ++k)
+                permutation[k] = (k * 7) % 40;
+            auto restored = NDArray<int, 2>::Zeros({40, 2});
+            scatter(restored, permutation, take(points, permutation));
+            same = true;
+            for (size_type i = 0; i < points.size(); ++i)
+                same = same && restored[i] == points[i];
+            assert(same && "scatter is not the inverse of take");
+
+            // Above Detail::PrefetchMinBytes, so rows are prefetched ahead
+            const size_type rows = Detail::PrefetchMinBytes / (2 * sizeof(double)) + 100;
+            auto large = NDArray<double, 2>::Empty({rows, 2});
+            for (size_type i = 0; i < large.size(); ++i)
+                large[i] = static_cast<double>(i);
+            std::vector<size_type> shuffled(rows);
+            for (size_type k = 0; k < rows; ++k)
+                shuffled[k] = (k * 7919) % rows;
+            const auto gathered = take(large, shuffled);
+            auto scattered = NDArray<double, 2>::Zeros({rows, 2});
+            scatter(scattered, shuffled, gathered);
+            same = gathered(5, 1) == large(shuffled[5], 1) && gathered(rows - 1, 0) == large(shuffled[rows - 1], 0);
+            for (size_type i = 0; i < large.size(); ++i)
+                same = same && scattered[i] == large[i];
+            assert(same && "Wrong take or scatter with prefetching");
+
+            auto odd = NDArray<bool, 1>::Full({40}, false);
+            for (size_type i = 1; i < 40; i += 2)
+                odd[i] = true;
+            DEBUG_ONLY const auto oddRows = compress(points, odd);
+            assert((oddRows.shape() == Shape<2>{20, 2}) && oddRows(3, 1) == points(7, 1) && "Wrong compress");
+
+            const auto values = NDArray<int, 1>({1, 2, 3, 4});
+            const auto cond = NDArray<bool, 1>({true, false, false, true});
+            const auto picked = where(cond, values, NDArray<double, 1>({0.5, 0.5, 0.5, 0.5}));
+            DEBUG_ONLY const auto clamped = where(cond, values, -1);
+            assert(picked[0] == 1.0 && picked[1] == 0.5 && picked[3] == 4.0 && "Wrong where");
+            assert(clamped[2] == -1 && clamped[3] == 4 && "Wrong scalar where");
+            std::cout << "where: " << picked[1] << std::endl;
+        }
     }
 
 }
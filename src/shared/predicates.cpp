@@ -0,0 +1,364 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Sparsh Jain
+ *
+ */
+
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <cpp_eigen_opencv/shared/predicates.hpp>
+#include <cpp_eigen_opencv/shared/debug.hpp>
+
+namespace Geometry
+{
+    namespace
+    {
+        // Expansion arithmetic after Shewchuk, "Adaptive Precision
+        // Floating-Point Arithmetic and Fast Robust Geometric Predicates"
+        // An expansion is a sum of non-overlapping doubles in increasing
+        // order of magnitude, its sign is the sign of the last component
+        using Expansion = std::vector<double>;
+
+        constexpr double epsilon = std::numeric_limits<double>::epsilon() / 2.0;
+        constexpr double ccwErrBound = (3.0 + 16.0 * epsilon) * epsilon;
+        constexpr double iccErrBound = (10.0 + 96.0 * epsilon) * epsilon;
+        constexpr double o3dErrBound = (7.0 + 56.0 * epsilon) * epsilon;
+
+        inline void twoSum(double a, double b, double &x, double &y)
+        {
+            x = a + b;
+            const double bVirtual = x - a;
+            const double aVirtual = x - bVirtual;
+            y = (a - aVirtual) + (b - bVirtual);
+        }
+
+        inline void fastTwoSum(double a, double b, double &x, double &y)
+        {
+            x = a + b;
+            y = b - (x - a);
+        }
+
+        inline void twoProduct(double a, double b, double &x, double &y)
+        {
+            x = a * b;
+            y = std::fma(a, b, -x);
+        }
+
+        // Exact a - b as a two component expansion
+        Expansion difference(double a, double b)
+        {
+            double x, y;
+            twoSum(a, -b, x, y);
+            return (y == 0.0) ? Expansion{x} : Expansion{y, x};
+        }
+
+        Expansion grow(const Expansion &e, double b)
+        {
+            Expansion h;
+            h.reserve(e.size() + 1);
+
+            double q = b;
+            for (const auto component : e)
+            {
+                double sum, err;
+                twoSum(q, component, sum, err);
+                if (err != 0.0)
+                    h.push_back(err);
+                q = sum;
+            }
+
+            if (q != 0.0 || h.empty())
+                h.push_back(q);
+            return h;
+        }
+
+        Expansion sum(const Expansion &e, const Expansion &f)
+        {
+            auto h = e;
+            for (const auto component : f)
+                h = grow(h, component);
+            return h;
+        }
+
+        Expansion negate(Expansion e)
+        {
+            for (auto &component : e)
+                component = -component;
+            return e;
+        }
+
+        Expansion scale(const Expansion &e, double b)
+        {
+            Expansion h;
+            h.reserve(2 * e.size());
+
+            double q, err;
+            twoProduct(e[0], b, q, err);
+            if (err != 0.0)
+                h.push_back(err);
+
+            for (std::size_t i = 1; i < e.size(); ++i)
+            {
+                double product1, product0, partial;
+                twoProduct(e[i], b, product1, product0);
+                twoSum(q, product0, partial, err);
+                if (err != 0.0)
+                    h.push_back(err);
+                fastTwoSum(product1, partial, q, err);
+                if (err != 0.0)
+                    h.push_back(err);
+            }
+
+            if (q != 0.0 || h.empty())
+                h.push_back(q);
+            return h;
+        }
+
+        Expansion product(const Expansion &e, const Expansion &f)
+        {
+            Expansion h{0.0};
+            for (const auto component : f)
+                h = sum(h, scale(e, component));
+            return h;
+        }
+
+        inline double sign(const Expansion &e)
+        {
+            return e.back();
+        }
+
+        double orient2dExact(
+            double ax, double ay,
+            double bx, double by,
+            double cx, double cy)
+        {
+            const auto acx = difference(ax, cx);
+            const auto acy = difference(ay, cy);
+            const auto bcx = difference(bx, cx);
+            const auto bcy = difference(by, cy);
+
+            return sign(sum(product(acx, bcy), negate(product(acy, bcx))));
+        }
+
+        double incircleExact(
+            double ax, double ay,
+            double bx, double by,
+            double cx, double cy,
+            double dx, double dy)
+        {
+            const auto adx = difference(ax, dx);
+            const auto ady = difference(ay, dy);
+            const auto bdx = difference(bx, dx);
+            const auto bdy = difference(by, dy);
+            const auto cdx = difference(cx, dx);
+            const auto cdy = difference(cy, dy);
+
+            const auto lift = [](const Expansion &x, const Expansion &y)
+            { return sum(product(x, x), product(y, y)); };
+            const auto cross = [](const Expansion &x0, const Expansion &y0,
+                                  const Expansion &x1, const Expansion &y1)
+            { return sum(product(x0, y1), negate(product(y0, x1))); };
+
+            const auto a = product(lift(adx, ady), cross(bdx, bdy, cdx, cdy));
+            const auto b = product(lift(bdx, bdy), cross(cdx, cdy, adx, ady));
+            const auto c = product(lift(cdx, cdy), cross(adx, ady, bdx, bdy));
+
+            return sign(sum(sum(a, b), c));
+        }
+
+        double orient3dExact(
+            double ax, double ay, double az,
+            double bx, double by, double bz,
+            double cx, double cy, double cz,
+            double dx, double dy, double dz)
+        {
+            const auto adx = difference(ax, dx);
+            const auto ady = difference(ay, dy);
+            const auto adz = difference(az, dz);
+            const auto bdx = difference(bx, dx);
+            const auto bdy = difference(by, dy);
+            const auto bdz = difference(bz, dz);
+            const auto cdx = difference(cx, dx);
+            const auto cdy = difference(cy, dy);
+            const auto cdz = difference(cz, dz);
+
+            const auto cross = [](const Expansion &x0, const Expansion &y0,
+                                  const Expansion &x1, const Expansion &y1)
+            { return sum(product(x0, y1), negate(product(y0, x1))); };
+
+            const auto a = product(adz, cross(bdx, bdy, cdx, cdy));
+            const auto b = product(bdz, cross(cdx, cdy, adx, ady));
+            const auto c = product(cdz, cross(adx, ady, bdx, bdy));
+
+            return -sign(sum(sum(a, b), c));
+        }
+    }
+
+    double orient2d(
+        double ax, double ay,
+        double bx, double by,
+        double cx, double cy)
+    {
+        const double detLeft = (ax - cx) * (by - cy);
+        const double detRight = (ay - cy) * (bx - cx);
+        const double det = detLeft - detRight;
+
+        const double errBound = ccwErrBound * (std::abs(detLeft) + std::abs(detRight));
+        if (std::abs(det) > errBound)
+            return det;
+
+        return orient2dExact(ax, ay, bx, by, cx, cy);
+    }
+
+    double incircle(
+        double ax, double ay,
+        double bx, double by,
+        double cx, double cy,
+        double dx, double dy)
+    {
+        const double adx = ax - dx;
+        const double ady = ay - dy;
+        const double bdx = bx - dx;
+        const double bdy = by - dy;
+        const double cdx = cx - dx;
+        const double cdy = cy - dy;
+
+        const double bdxcdy = bdx * cdy;
+        const double cdxbdy = cdx * bdy;
+        const double alift = adx * adx + ady * ady;
+
+        const double cdxady = cdx * ady;
+        const double adxcdy = adx * cdy;
+        const double blift = bdx * bdx + bdy * bdy;
+
+        const double adxbdy = adx * bdy;
+        const double bdxady = bdx * ady;
+        const double clift = cdx * cdx + cdy * cdy;
+
+        const double det = alift * (bdxcdy - cdxbdy) +
+                           blift * (cdxady - adxcdy) +
+                           clift * (adxbdy - bdxady);
+
+        const double permanent = (std::abs(bdxcdy) + std::abs(cdxbdy)) * alift +
+                                 (std::abs(cdxady) + std::abs(adxcdy)) * blift +
+                                 (std::abs(adxbdy) + std::abs(bdxady)) * clift;
+        if (std::abs(det) > iccErrBound * permanent)
+            return det;
+
+        return incircleExact(ax, ay, bx, by, cx, cy, dx, dy);
+    }
+
+    double orient3d(
+        double ax, double ay, double az,
+        double bx, double by, double bz,
+        double cx, double cy, double cz,
+        double dx, double dy, double dz)
+    {
+        const double adx = ax - dx;
+        const double ady = ay - dy;
+        const double adz = az - dz;
+        const double bdx = bx - dx;
+        const double bdy = by - dy;
+        const double bdz = bz - dz;
+        const double cdx = cx - dx;
+        const double cdy = cy - dy;
+        const double cdz = cz - dz;
+
+        const double bdxcdy = bdx * cdy;
+        const double cdxbdy = cdx * bdy;
+        const double cdxady = cdx * ady;
+        const double adxcdy = adx * cdy;
+        const double adxbdy = adx * bdy;
+        const double bdxady = bdx * ady;
+
+        // Determinant of the rows a - d, b - d, c - d, which is positive
+        // when d is below, hence the negation
+        const double det = adz * (bdxcdy - cdxbdy) +
+                           bdz * (cdxady - adxcdy) +
+                           cdz * (adxbdy - bdxady);
+
+        const double permanent = (std::abs(bdxcdy) + std::abs(cdxbdy)) * std::abs(adz) +
+                                 (std::abs(cdxady) + std::abs(adxcdy)) * std::abs(bdz) +
+                                 (std::abs(adxbdy) + std::abs(bdxady)) * std::abs(cdz);
+        if (std::abs(det) > o3dErrBound * permanent)
+            return -det;
+
+        return orient3dExact(ax, ay, az, bx, by, bz, cx, cy, cz, dx, dy, dz);
+    }
+
+    void testPredicates()
+    {
+        std::cout << "Running tests for predicates..." << std::endl;
+
+        // Points on the line y = x perturbed by at most one ulp, where the
+        // naive determinant frequently gets the sign wrong
+        std::mt19937 rng(53); // Fixed seed for reproducibility
+        std::uniform_int_distribution<int> ulps(-1, 1);
+
+        for (int iter = 0; iter < 1000; ++iter)
+        {
+            const double x = 0.5 + static_cast<double>(iter) * 1e-3;
+            const double y = std::nextafter(x, x + static_cast<double>(ulps(rng)));
+
+            // Exactly collinear points
+            DEBUG_ONLY const double collinear = orient2d(0.0, 0.0, 12.0, 12.0, x, x);
+            assert(collinear == 0.0 && "Collinear points not detected");
+
+            // Swapping two points flips the sign
+            DEBUG_ONLY const double o1 = orient2d(12.0, 12.0, 24.0, 24.0, x, y);
+            DEBUG_ONLY const double o2 = orient2d(24.0, 24.0, 12.0, 12.0, x, y);
+            assert(((o1 > 0.0 && o2 < 0.0) || (o1 < 0.0 && o2 > 0.0) ||
+                    (o1 == 0.0 && o2 == 0.0)) &&
+                   "Orientation not antisymmetric");
+
+            // Sign agrees with the exact answer y - x
+            assert(((y > x) == (o1 > 0.0)) && ((y < x) == (o1 < 0.0)) &&
+                   "Orientation sign wrong");
+        }
+
+        // Cocircular points on an integer grid and points just off the circle
+        for (int r = 1; r < 200; ++r)
+        {
+            const double s = static_cast<double>(r);
+            DEBUG_ONLY const double on = incircle(s, 0.0, 0.0, s, -s, 0.0, 0.0, -s);
+            assert(on == 0.0 && "Cocircular points not detected");
+
+            DEBUG_ONLY const double inside = incircle(s, 0.0, 0.0, s, -s, 0.0,
+                                                      0.0, std::nextafter(-s, 0.0));
+            DEBUG_ONLY const double outside = incircle(s, 0.0, 0.0, s, -s, 0.0,
+                                                       0.0, std::nextafter(-s, -2.0 * s));
+            assert(inside > 0.0 && "Point inside circle not detected");
+            assert(outside < 0.0 && "Point outside circle not detected");
+        }
+
+        // Points on the plane z = x + y perturbed by at most one ulp,
+        // dyadic coordinates keep x + y exact
+        for (int iter = 0; iter < 1000; ++iter)
+        {
+            const double x = 0.25 + static_cast<double>(iter) / 4096.0;
+            const double y = 0.5 + static_cast<double>(iter) / 8192.0;
+            const double z = std::nextafter(x + y, x + y + static_cast<double>(ulps(rng)));
+
+            DEBUG_ONLY const double above = orient3d(0.0, 0.0, 0.0,
+                                                     1.0, 0.0, 1.0,
+                                                     0.0, 1.0, 1.0,
+                                                     x, y, z);
+            DEBUG_ONLY const double below = orient3d(0.0, 0.0, 0.0,
+                                                     0.0, 1.0, 1.0,
+                                                     1.0, 0.0, 1.0,
+                                                     x, y, z);
+            assert(((z > x + y) == (above > 0.0)) && ((z < x + y) == (above < 0.0)) &&
+                   "Orientation 3D sign wrong");
+            assert(((above > 0.0 && below < 0.0) || (above < 0.0 && below > 0.0) ||
+                    (above == 0.0 && below == 0.0)) &&
+                   "Orientation 3D not antisymmetric");
+        }
+    }
+
+} // namespace Geometry
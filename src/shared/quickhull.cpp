@@ -0,0 +1,560 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Sparsh Jain
+ *
+ */
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <utility>
+
+#include <cpp_eigen_opencv/shared/ndarray.hpp>
+#include <cpp_eigen_opencv/shared/geometry.hpp>
+#include <cpp_eigen_opencv/shared/predicates.hpp>
+#include <cpp_eigen_opencv/shared/parallel.hpp>
+#include <cpp_eigen_opencv/shared/quickhull.hpp>
+#include <cpp_eigen_opencv/shared/debug.hpp>
+
+namespace Geometry
+{
+    namespace
+    {
+        constexpr size_type None = std::numeric_limits<size_type>::max();
+
+        class QuickHull final
+        {
+        private:
+            struct Face
+            {
+                std::array<size_type, 3> vertex;   // counter-clockwise from outside
+                std::array<size_type, 3> neighbor; // across vertex[k] -> vertex[k + 1]
+                double nx, ny, nz, offset;         // unit normal and plane offset
+                size_type conflictHead;            // first point of the conflict list
+                size_type furthest;                // conflict point farthest away
+                double furthestDistance;
+                size_type visibleStamp;
+                size_type hiddenStamp;
+                bool alive;
+            };
+
+            struct HorizonEdge
+            {
+                size_type from;
+                size_type to;
+                size_type outside;     // face across the horizon
+                size_type outsideEdge; // edge index in that face
+            };
+
+            const NDArray<double, 2> &m_points;
+            const size_type m_size;
+
+            std::vector<Face> m_faces{};
+            std::vector<size_type> m_free{};         // reusable face slots
+            std::vector<size_type> m_nextConflict{}; // per point, conflict list link
+            std::vector<size_type> m_startOf{};      // per point, new face starting there
+            std::vector<size_type> m_work{};         // faces that may have conflicts
+            size_type m_stamp{0};
+
+            // Scratch reused by every iteration
+            std::vector<size_type> m_stack{};
+            std::vector<size_type> m_visible{};
+            std::vector<HorizonEdge> m_horizon{};
+            std::vector<size_type> m_newFaces{};
+            std::vector<size_type> m_orphans{};
+            std::vector<size_type> m_assignment{};
+            std::vector<double> m_assignmentDistance{};
+
+            inline double orient(size_type f, size_type p) const
+            {
+                const auto &v = m_faces[f].vertex;
+                return orient3d(m_points(v[0], 0), m_points(v[0], 1), m_points(v[0], 2),
+                                m_points(v[1], 0), m_points(v[1], 1), m_points(v[1], 2),
+                                m_points(v[2], 0), m_points(v[2], 1), m_points(v[2], 2),
+                                m_points(p, 0), m_points(p, 1), m_points(p, 2));
+            }
+
+            inline double distance(size_type f, size_type p) const
+            {
+                const auto &face = m_faces[f];
+                return face.nx * m_points(p, 0) + face.ny * m_points(p, 1) +
+                       face.nz * m_points(p, 2) - face.offset;
+            }
+
+            size_type newFace(size_type a, size_type b, size_type c)
+            {
+                const double abx = m_points(b, 0) - m_points(a, 0);
+                const double aby = m_points(b, 1) - m_points(a, 1);
+                const double abz = m_points(b, 2) - m_points(a, 2);
+                const double acx = m_points(c, 0) - m_points(a, 0);
+                const double acy = m_points(c, 1) - m_points(a, 1);
+                const double acz = m_points(c, 2) - m_points(a, 2);
+
+                double nx = aby * acz - abz * acy;
+                double ny = abz * acx - abx * acz;
+                double nz = abx * acy - aby * acx;
+                const double length = std::sqrt(nx * nx + ny * ny + nz * nz);
+                if (length > 0.0)
+                {
+                    nx /= length;
+                    ny /= length;
+                    nz /= length;
+                }
+
+                const Face face{{a, b, c},
+                                {None, None, None},
+                                nx, ny, nz,
+                                nx * m_points(a, 0) + ny * m_points(a, 1) + nz * m_points(a, 2),
+                                None,
+                                None,
+                                0.0,
+                                0,
+                                0,
+                                true};
+
+                if (!m_free.empty())
+                {
+                    const auto f = m_free.back();
+                    m_free.pop_back();
+                    m_faces[f] = face;
+                    return f;
+                }
+
+                m_faces.push_back(face);
+                return m_faces.size() - 1;
+            }
+
+            // Move every point of m_orphans to the conflict list of the
+            // candidate face it is farthest above, dropping points inside
+            // The search is independent per point and runs in parallel
+            void partition(const std::vector<size_type> &candidates)
+            {
+                const auto n = m_orphans.size();
+                m_assignment.resize(n);
+                m_assignmentDistance.resize(n);
+
+                const auto chunks = Parallel::chunkCount(n, 4096);
+                Parallel::parallelForChunks(0, n, chunks, [&](size_type lo, size_type hi, size_type)
+                                            {
+                                                for (size_type i = lo; i < hi; ++i)
+                                                {
+                                                    const auto p = m_orphans[i];
+                                                    auto best = None;
+                                                    double bestDistance = 0.0;
+                                                    for (const auto f : candidates)
+                                                    {
+                                                        const auto d = distance(f, p);
+                                                        if ((best == None || d > bestDistance) && orient(f, p) > 0.0)
+                                                        {
+                                                            best = f;
+                                                            bestDistance = d;
+                                                        }
+                                                    }
+                                                    m_assignment[i] = best;
+                                                    m_assignmentDistance[i] = bestDistance;
+                                                } });
+
+                for (size_type i = 0; i < n; ++i)
+                {
+                    const auto f = m_assignment[i];
+                    if (f == None)
+                        continue;
+
+                    auto &face = m_faces[f];
+                    const auto p = m_orphans[i];
+                    m_nextConflict[p] = face.conflictHead;
+                    face.conflictHead = p;
+                    if (face.furthest == None || m_assignmentDistance[i] > face.furthestDistance)
+                    {
+                        face.furthest = p;
+                        face.furthestDistance = m_assignmentDistance[i];
+                    }
+                }
+            }
+
+            // Initial tetrahedron from extreme points, false if all points are coplanar
+            bool initialSimplex()
+            {
+                const auto N = m_size;
+                const auto coordinate = [this](size_type p, size_type d)
+                { return m_points(p, d); };
+
+                std::array<size_type, 6> extremes{};
+                for (size_type d = 0; d < 3; ++d)
+                {
+                    extremes[2 * d] = extremes[2 * d + 1] = 0;
+                    for (size_type p = 1; p < N; ++p)
+                    {
+                        if (coordinate(p, d) < coordinate(extremes[2 * d], d))
+                            extremes[2 * d] = p;
+                        if (coordinate(p, d) > coordinate(extremes[2 * d + 1], d))
+                            extremes[2 * d + 1] = p;
+                    }
+                }
+
+                const auto distanceSquared = [&](size_type a, size_type b)
+                {
+                    double d2 = 0.0;
+                    for (size_type d = 0; d < 3; ++d)
+                        d2 += (coordinate(a, d) - coordinate(b, d)) * (coordinate(a, d) - coordinate(b, d));
+                    return d2;
+                };
+
+                size_type a = 0, b = 0;
+                double farthest = 0.0;
+                for (const auto i : extremes)
+                {
+                    for (const auto j : extremes)
+                    {
+                        if (distanceSquared(i, j) > farthest)
+                        {
+                            farthest = distanceSquared(i, j);
+                            a = i;
+                            b = j;
+                        }
+                    }
+                }
+                if (farthest == 0.0)
+                    return false;
+
+                // Farthest from the line ab
+                size_type c = None;
+                farthest = 0.0;
+                for (size_type p = 0; p < N; ++p)
+                {
+                    const double abx = coordinate(b, 0) - coordinate(a, 0);
+                    const double aby = coordinate(b, 1) - coordinate(a, 1);
+                    const double abz = coordinate(b, 2) - coordinate(a, 2);
+                    const double apx = coordinate(p, 0) - coordinate(a, 0);
+                    const double apy = coordinate(p, 1) - coordinate(a, 1);
+                    const double apz = coordinate(p, 2) - coordinate(a, 2);
+                    const double cx = aby * apz - abz * apy;
+                    const double cy = abz * apx - abx * apz;
+                    const double cz = abx * apy - aby * apx;
+                    const double d2 = cx * cx + cy * cy + cz * cz;
+                    if (d2 > farthest)
+                    {
+                        farthest = d2;
+                        c = p;
+                    }
+                }
+                if (c == None)
+                    return false;
+
+                // Farthest from the plane abc
+                size_type d = None;
+                double volume = 0.0;
+                for (size_type p = 0; p < N; ++p)
+                {
+                    const double v = orient3d(
+                        coordinate(a, 0), coordinate(a, 1), coordinate(a, 2),
+                        coordinate(b, 0), coordinate(b, 1), coordinate(b, 2),
+                        coordinate(c, 0), coordinate(c, 1), coordinate(c, 2),
+                        coordinate(p, 0), coordinate(p, 1), coordinate(p, 2));
+                    if (std::abs(v) > std::abs(volume))
+                    {
+                        volume = v;
+                        d = p;
+                    }
+                }
+                if (d == None)
+                    return false;
+
+                // Orient the base so that d is below it
+                if (volume > 0.0)
+                    std::swap(b, c);
+
+                const std::array<size_type, 4> faces{newFace(a, b, c),
+                                                     newFace(a, d, b),
+                                                     newFace(b, d, c),
+                                                     newFace(c, d, a)};
+
+                // Pair every directed edge with its reverse
+                for (const auto f : faces)
+                {
+                    for (size_type k = 0; k < 3; ++k)
+                    {
+                        const auto from = m_faces[f].vertex[k];
+                        const auto to = m_faces[f].vertex[(k + 1) % 3];
+                        for (const auto g : faces)
+                        {
+                            for (size_type j = 0; j < 3; ++j)
+                            {
+                                if (m_faces[g].vertex[j] == to && m_faces[g].vertex[(j + 1) % 3] == from)
+                                    m_faces[f].neighbor[k] = g;
+                            }
+                        }
+                    }
+                }
+
+                m_orphans.clear();
+                for (size_type p = 0; p < N; ++p)
+                {
+                    if (p != a && p != b && p != c && p != d)
+                        m_orphans.push_back(p);
+                }
+
+                const std::vector<size_type> candidates(faces.begin(), faces.end());
+                partition(candidates);
+                m_work.assign(faces.begin(), faces.end());
+                return true;
+            }
+
+            void addPoint(size_type seed)
+            {
+                const auto eye = m_faces[seed].furthest;
+                const auto stamp = ++m_stamp;
+
+                // Faces strictly visible from the eye form a disk, its
+                // boundary edges are the horizon
+                m_visible.clear();
+                m_horizon.clear();
+                m_stack.assign(1, seed);
+                m_faces[seed].visibleStamp = stamp;
+                while (!m_stack.empty())
+                {
+                    const auto f = m_stack.back();
+                    m_stack.pop_back();
+                    m_visible.push_back(f);
+
+                    for (size_type k = 0; k < 3; ++k)
+                    {
+                        const auto g = m_faces[f].neighbor[k];
+                        if (m_faces[g].visibleStamp == stamp)
+                            continue;
+
+                        if (m_faces[g].hiddenStamp != stamp && orient(g, eye) > 0.0)
+                        {
+                            m_faces[g].visibleStamp = stamp;
+                            m_stack.push_back(g);
+                            continue;
+                        }
+
+                        m_faces[g].hiddenStamp = stamp;
+                        size_type edge = 0;
+                        while (m_faces[g].neighbor[edge] != f)
+                            ++edge;
+                        m_horizon.push_back({m_faces[f].vertex[k],
+                                             m_faces[f].vertex[(k + 1) % 3],
+                                             g,
+                                             edge});
+                    }
+                }
+
+                // Collect the conflict points of the visible faces, then free them
+                m_orphans.clear();
+                for (const auto f : m_visible)
+                {
+                    for (auto p = m_faces[f].conflictHead; p != None; p = m_nextConflict[p])
+                    {
+                        if (p != eye)
+                            m_orphans.push_back(p);
+                    }
+                    m_faces[f].alive = false;
+                    m_free.push_back(f);
+                }
+
+                // Cone from the eye to the horizon
+                m_newFaces.clear();
+                for (const auto &edge : m_horizon)
+                {
+                    const auto f = newFace(edge.from, edge.to, eye);
+                    m_faces[f].neighbor[0] = edge.outside;
+                    m_faces[edge.outside].neighbor[edge.outsideEdge] = f;
+                    m_startOf[edge.from] = f;
+                    m_newFaces.push_back(f);
+                }
+
+                for (const auto f : m_newFaces)
+                {
+                    const auto next = m_startOf[m_faces[f].vertex[1]];
+                    m_faces[f].neighbor[1] = next;
+                    m_faces[next].neighbor[2] = f;
+                }
+
+                partition(m_newFaces);
+                for (const auto f : m_newFaces)
+                {
+                    if (m_faces[f].conflictHead != None)
+                        m_work.push_back(f);
+                }
+            }
+
+        public:
+            explicit QuickHull(const NDArray<double, 2> &points, size_type N)
+                : m_points(points),
+                  m_size(N),
+                  m_nextConflict(N, None),
+                  m_startOf(N, None)
+            {
+            }
+
+            TriangleMesh run()
+            {
+                TriangleMesh mesh{};
+                if (m_size < 4 || !initialSimplex())
+                    return mesh;
+
+                while (!m_work.empty())
+                {
+                    const auto f = m_work.back();
+                    m_work.pop_back();
+                    if (m_faces[f].alive && m_faces[f].conflictHead != None)
+                        addPoint(f);
+                }
+
+                std::vector<std::uint8_t> used(m_size, 0);
+                for (const auto &face : m_faces)
+                {
+                    if (!face.alive)
+                        continue;
+                    for (const auto v : face.vertex)
+                    {
+                        mesh.triangles.push_back(v);
+                        used[v] = 1;
+                    }
+                }
+
+                for (size_type p = 0; p < m_size; ++p)
+                {
+                    if (used[p])
+                        mesh.vertices.push_back(p);
+                }
+
+                return mesh;
+            }
+        };
+    }
+
+    TriangleMesh convexHull3D(
+        const NDArray<double, 2> &points,
+        const int count)
+    {
+        const auto N = (count < 0) ? points.shape()[0] : static_cast<size_type>(count);
+        assert(N <= points.shape()[0]);
+        assert(points.shape()[1] == 3 && "convexHull3D expects 3D points");
+
+        return QuickHull(points, N).run();
+    }
+
+    /**************************************************************************/
+
+    namespace
+    {
+        void testConvexHull3DInvariants(const NDArray<double, 2> &points, bool checkAll = true)
+        {
+            const auto N = points.shape()[0];
+            const auto mesh = convexHull3D(points);
+            const auto F = mesh.numTriangles();
+            const auto &tris = mesh.triangles;
+            if (F == 0)
+                return;
+
+            DEBUG_ONLY const auto orientFace = [&](size_type f, size_type p)
+            {
+                const auto a = tris[3 * f], b = tris[3 * f + 1], c = tris[3 * f + 2];
+                return orient3d(points(a, 0), points(a, 1), points(a, 2),
+                                points(b, 0), points(b, 1), points(b, 2),
+                                points(c, 0), points(c, 1), points(c, 2),
+                                points(p, 0), points(p, 1), points(p, 2));
+            };
+
+            // Every directed edge appears once and its reverse appears once
+            std::vector<std::pair<size_type, size_type>> edges;
+            for (size_type f = 0; f < F; ++f)
+            {
+                for (size_type k = 0; k < 3; ++k)
+                    edges.emplace_back(tris[3 * f + k], tris[3 * f + (k + 1) % 3]);
+            }
+            std::sort(edges.begin(), edges.end());
+            assert(std::adjacent_find(edges.begin(), edges.end()) == edges.end() &&
+                   "Directed edge used twice");
+            for (DEBUG_ONLY const auto &[from, to] : edges)
+            {
+                assert(std::binary_search(edges.begin(), edges.end(), std::make_pair(to, from)) &&
+                       "Mesh not closed");
+            }
+
+            // Euler's formula for a closed genus 0 surface
+            DEBUG_ONLY const auto V = mesh.vertices.size();
+            DEBUG_ONLY const auto E = edges.size() / 2;
+            assert(V + F == E + 2 && "Euler characteristic is not 2");
+
+            // No point lies strictly outside any face
+            const auto stride = checkAll ? 1 : std::max<size_type>(1, N / 500);
+            for (size_type f = 0; f < F; ++f)
+            {
+                assert(orientFace(f, tris[3 * f]) == 0.0);
+                for (size_type p = 0; p < N; p += stride)
+                    assert(orientFace(f, p) <= 0.0 && "Point outside hull face");
+            }
+        }
+    }
+
+    void testConvexHull3D()
+    {
+        std::cout << "Running tests for convexHull3D..." << std::endl;
+
+        std::mt19937 rng(56); // Fixed seed for reproducibility
+        std::uniform_real_distribution<double> dist(-1000.0, 1000.0);
+        std::normal_distribution<double> normal(0.0, 1.0);
+        std::uniform_int_distribution<int> grid(0, 4);
+
+        for (int iter = 0; iter < 60; ++iter)
+        {
+            const size_type numPoints = rng() % 600 + 1;
+            auto points = NDArray<double, 2>::Empty({numPoints, 3});
+
+            for (size_type i = 0; i < numPoints; ++i)
+            {
+                switch (iter % 3)
+                {
+                case 0: // Random in a cube
+                    for (size_type d = 0; d < 3; ++d)
+                        points(i, d) = dist(rng);
+                    break;
+                case 1: // Integer grid, many coplanar and duplicate points
+                    for (size_type d = 0; d < 3; ++d)
+                        points(i, d) = grid(rng);
+                    break;
+                default: // On a sphere, almost every point is a hull vertex
+                {
+                    const double x = normal(rng), y = normal(rng), z = normal(rng);
+                    const double r = std::sqrt(x * x + y * y + z * z);
+                    points(i, 0) = 100.0 * x / r;
+                    points(i, 1) = 100.0 * y / r;
+                    points(i, 2) = 100.0 * z / r;
+                    break;
+                }
+                }
+            }
+
+            testConvexHull3DInvariants(points);
+        }
+
+        // Coplanar input has no hull, integer coordinates keep it exactly planar
+        std::uniform_int_distribution<int> integer(-1000, 1000);
+        auto plane = NDArray<double, 2>::Empty({100, 3});
+        for (size_type i = 0; i < 100; ++i)
+        {
+            plane(i, 0) = integer(rng);
+            plane(i, 1) = integer(rng);
+            plane(i, 2) = 3.0 * plane(i, 0) - 2.0 * plane(i, 1);
+        }
+        assert(convexHull3D(plane).numTriangles() == 0 && "Coplanar points produced a hull");
+
+        // Large cloud to exercise the parallel partitioning
+        auto cloud = NDArray<double, 2>::Empty({50000, 3});
+        for (size_type i = 0; i < cloud.shape()[0]; ++i)
+        {
+            for (size_type d = 0; d < 3; ++d)
+                cloud(i, d) = normal(rng);
+        }
+        testConvexHull3DInvariants(cloud, false);
+    }
+
+} // namespace Geometry
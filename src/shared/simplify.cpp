@@ -0,0 +1,131 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Sparsh Jain
+ *
+ */
+
+#include <iostream>
+#include <random>
+
+#include <cpp_eigen_opencv/shared/ndarray.hpp>
+#include <cpp_eigen_opencv/shared/geometry.hpp>
+#include <cpp_eigen_opencv/shared/simplify.hpp>
+#include <cpp_eigen_opencv/shared/debug.hpp>
+
+namespace Geometry
+{
+    namespace
+    {
+        // Every dropped row lies within tolerance of the kept segment spanning it
+        void testWithinTolerance(
+            const NDArray<double, 2> &points,
+            const std::vector<size_type> &kept,
+            const bool closed,
+            DEBUG_ONLY const double tolerance)
+        {
+            const auto N = points.shape()[0];
+            const auto segments = closed ? kept.size() : kept.size() - 1;
+            for (size_type s = 0; s < segments; ++s)
+            {
+                const auto a = kept[s];
+                const auto b = kept[(s + 1) % kept.size()];
+                const auto end = (b > a) ? b : b + N;
+                for (auto position = a + 1; position < end; ++position)
+                {
+                    assert(Detail::segmentDistance(points, position % N, a, b) <= tolerance &&
+                           "Dropped point too far from simplified polyline");
+                }
+            }
+        }
+
+        // Pixel staircase around a circle, as produced by contour tracing
+        NDArray<double, 2> staircaseCircle(double radius)
+        {
+            std::vector<std::pair<double, double>> contour;
+            const auto steps = static_cast<size_type>(8.0 * radius);
+            for (size_type i = 0; i < steps; ++i)
+            {
+                const double angle = 2.0 * pi * static_cast<double>(i) / static_cast<double>(steps);
+                const std::pair<double, double> p{std::round(radius * std::cos(angle)),
+                                                  std::round(radius * std::sin(angle))};
+                if (contour.empty() || contour.back() != p)
+                    contour.push_back(p);
+            }
+
+            auto points = NDArray<double, 2>::Empty({contour.size(), 2});
+            for (size_type i = 0; i < contour.size(); ++i)
+            {
+                points(i, 0) = contour[i].first;
+                points(i, 1) = contour[i].second;
+            }
+            return points;
+        }
+    }
+
+    void testSimplify()
+    {
+        std::cout << "Running tests for polyline simplification..." << std::endl;
+
+        std::mt19937 rng(55); // Fixed seed for reproducibility
+        std::normal_distribution<double> step(0.0, 3.0);
+
+        for (int iter = 0; iter < 200; ++iter)
+        {
+            // Random walk polyline
+            const size_type numPoints = rng() % 2000 + 1;
+            auto points = NDArray<double, 2>::Empty({numPoints, 2});
+            double x = 0.0, y = 0.0;
+            for (size_type i = 0; i < numPoints; ++i)
+            {
+                x += step(rng) + 1.0;
+                y += step(rng);
+                points(i, 0) = x;
+                points(i, 1) = y;
+            }
+
+            const bool closed = iter % 2 == 1;
+            const double epsilon = 0.5 + static_cast<double>(iter % 7);
+
+            const auto dp = simplifyDouglasPeuckerIndices(points, epsilon, closed);
+            assert(!dp.empty() && dp.front() == 0 && "First point not kept");
+            assert((closed || dp.back() == numPoints - 1) && "Last point not kept");
+            assert(std::is_sorted(dp.begin(), dp.end()) && "Kept rows not sorted");
+            testWithinTolerance(points, dp, closed, epsilon);
+
+            const auto vw = simplifyVisvalingamIndices(points, epsilon * epsilon, closed);
+            assert(std::is_sorted(vw.begin(), vw.end()) && "Kept rows not sorted");
+            assert(vw.size() >= std::min<size_type>(numPoints, closed ? 3 : 2) &&
+                   "Too many points removed");
+            assert((closed || (vw.front() == 0 && vw.back() == numPoints - 1)) &&
+                   "End points not kept");
+
+            // Every removed point's area was below the threshold, and the
+            // remaining interior points are all at or above it
+            const auto K = vw.size();
+            const auto interior = closed ? K : K - 1;
+            for (size_type k = closed ? 0 : 1; K > (closed ? 3u : 2u) && k < interior; ++k)
+            {
+                DEBUG_ONLY const double area = Detail::triangleArea(
+                    points, vw[(k + K - 1) % K], vw[k], vw[(k + 1) % K]);
+                assert(area >= epsilon * epsilon && "Point below threshold kept");
+            }
+        }
+
+        // Staircase contours shrink substantially and stay close to the circle
+        for (const double radius : {20.0, 100.0, 500.0})
+        {
+            const auto contour = staircaseCircle(radius);
+            DEBUG_ONLY const auto simplified = simplifyDouglasPeucker(contour, 1.0, true);
+            assert(simplified.shape()[0] * 4 < contour.shape()[0] &&
+                   "Staircase contour not simplified");
+
+            for (size_type i = 0; i < simplified.shape()[0]; ++i)
+            {
+                assert(std::abs(std::hypot(simplified(i, 0), simplified(i, 1)) - radius) <= 1.0 &&
+                       "Simplified point off the contour");
+            }
+        }
+    }
+
+} // namespace Geometry
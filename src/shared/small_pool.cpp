@@ -0,0 +1,158 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Sparsh Jain
+ *
+ */
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <iostream>
+#include <new>
+#include <thread>
+#include <utility>
+
+#include <cpp_eigen_opencv/shared/ndarray.hpp>
+#include <cpp_eigen_opencv/shared/dynarray.hpp>
+#include <cpp_eigen_opencv/shared/small_pool.hpp>
+#include <cpp_eigen_opencv/shared/debug.hpp>
+
+namespace ND::Detail
+{
+    namespace
+    {
+        constexpr std::size_t Classes = SmallBlockBytes / SmallBlockAlign;
+
+        // Cap per size class, so a thread that only frees arrays made
+        // elsewhere does not keep their memory forever
+        constexpr std::size_t MaxCachedBlocks = 64;
+
+        struct FreeBlock
+        {
+            FreeBlock *next;
+        };
+
+        // Arrays released after the pool of their thread is gone, e.g.
+        // statics destroyed at exit, go straight to operator delete
+        thread_local bool g_poolClosed = false;
+
+        struct Pool
+        {
+            std::array<FreeBlock *, Classes> heads{};
+            std::array<std::size_t, Classes> counts{};
+
+            Pool() = default;
+            Pool(const Pool &) = delete;
+            Pool &operator=(const Pool &) = delete;
+
+            ~Pool()
+            {
+                g_poolClosed = true;
+                for (std::size_t c = 0; c < Classes; ++c)
+                {
+                    while (heads[c] != nullptr)
+                    {
+                        auto *block = heads[c];
+                        heads[c] = block->next;
+                        ::operator delete(block, (c + 1) * SmallBlockAlign);
+                    }
+                }
+            }
+        };
+
+        thread_local Pool g_pool;
+
+        inline std::size_t sizeClass(std::size_t bytes)
+        {
+            return (std::max<std::size_t>(bytes, 1) + SmallBlockAlign - 1) / SmallBlockAlign - 1;
+        }
+    }
+
+    void *allocateSmallBlock(std::size_t bytes)
+    {
+        const auto c = sizeClass(bytes);
+        if (!g_poolClosed && g_pool.heads[c] != nullptr)
+        {
+            auto *block = g_pool.heads[c];
+            g_pool.heads[c] = block->next;
+            --g_pool.counts[c];
+            return block;
+        }
+        return ::operator new((c + 1) * SmallBlockAlign);
+    }
+
+    void deallocateSmallBlock(void *block, std::size_t bytes) noexcept
+    {
+        const auto c = sizeClass(bytes);
+        if (!g_poolClosed && g_pool.counts[c] < MaxCachedBlocks)
+        {
+            g_pool.heads[c] = ::new (block) FreeBlock{g_pool.heads[c]};
+            ++g_pool.counts[c];
+            return;
+        }
+        ::operator delete(block, (c + 1) * SmallBlockAlign);
+    }
+
+    std::size_t smallBlocksCached()
+    {
+        if (g_poolClosed)
+            return 0;
+
+        std::size_t cached = 0;
+        for (const auto count : g_pool.counts)
+            cached += count;
+        return cached;
+    }
+
+} // namespace ND::Detail
+
+namespace ND
+{
+    void testSmallPool()
+    {
+        std::cout << "Running tests for the small array pool..." << std::endl;
+
+        if constexpr (smallArraySize >= 2 && !allocationTrackingEnabled)
+        {
+            // A freed buffer is handed to the next array of its size
+            DEBUG_ONLY const double *first = nullptr;
+            {
+                const auto point = NDArray<double, 1>({1.0, 2.0});
+                first = point.data();
+            }
+            DEBUG_ONLY const auto cached = Detail::smallBlocksCached();
+            DEBUG_ONLY const auto point = NDArray<double, 1>({3.0, 4.0});
+            assert(point.data() == first && Detail::smallBlocksCached() + 1 == cached && "Block not reused");
+            assert(point[0] == 3.0 && point[1] == 4.0 && "Reused block lost the values");
+        }
+
+        // Pooled buffers keep the sharing rules of NDArray
+        auto small = NDArray<int, 1>::Zeros({2});
+        auto alias = small;
+        alias[1] = 7;
+        assert(small[1] == 7 && "Small copies no longer share");
+
+        auto cow = small.CopyOnWrite();
+        cow[0] = 1;
+        assert(small[0] == 0 && cow[0] == 1 && cow[1] == 7 && "Copy-on-write of a small array");
+
+        DEBUG_ONLY const DynArray shared(small);
+        assert(shared.data() == std::as_const(small).data() && shared.at(1) == 7.0 && "DynArray copied");
+
+        // Every element count up to the limit and one past it, plus arrays
+        // freed by a thread other than the one that made them
+        for (std::size_t n = 1; n <= smallArraySize + 1; ++n)
+        {
+            auto values = NDArray<double, 1>::Full({n}, static_cast<double>(n));
+            std::thread([moved = std::move(values), n]()
+                        {
+                            DEBUG_ONLY bool same = true;
+                            for (std::size_t i = 0; i < n; ++i)
+                                same = same && moved[i] == static_cast<double>(n);
+                            assert(same && "Small array corrupted"); })
+                .join();
+        }
+    }
+
+} // namespace ND
@@ -0,0 +1,133 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Sparsh Jain
+ *
+ */
+
+#include <iostream>
+#include <random>
+
+#include <cpp_eigen_opencv/shared/ndarray.hpp>
+#include <cpp_eigen_opencv/shared/spatial_hash.hpp>
+#include <cpp_eigen_opencv/shared/debug.hpp>
+
+namespace Geometry
+{
+    namespace
+    {
+        void testSpatialHashInvariants(
+            const SpatialHash<double> &grid,
+            const NDArray<double, 2> &points,
+            double radius)
+        {
+            const auto N = points.shape()[0];
+            const double r2 = radius * radius;
+            const auto within = [&](size_type i, double x, double y)
+            {
+                const double dx = points(i, 0) - x;
+                const double dy = points(i, 1) - y;
+                return dx * dx + dy * dy <= r2;
+            };
+
+            // Radius search returns exactly the points within radius
+            std::vector<size_type> found;
+            for (size_type q = 0; q < std::min<size_type>(N, 50); ++q)
+            {
+                grid.radiusSearch(points(q, 0), points(q, 1), radius, found);
+                std::sort(found.begin(), found.end());
+
+                std::vector<size_type> expected;
+                for (size_type i = 0; i < N; ++i)
+                {
+                    if (within(i, points(q, 0), points(q, 1)))
+                        expected.push_back(i);
+                }
+
+                assert(found == expected && "Radius search mismatch");
+            }
+
+            // Neighbor pairs match brute force
+            std::vector<std::pair<size_type, size_type>> expected;
+            for (size_type i = 0; i < N; ++i)
+            {
+                for (size_type j = i + 1; j < N; ++j)
+                {
+                    if (within(j, points(i, 0), points(i, 1)))
+                        expected.emplace_back(i, j);
+                }
+            }
+
+            DEBUG_ONLY const auto pairs = grid.neighborPairs(radius);
+            assert(pairs == expected && "Neighbor pairs mismatch");
+        }
+    }
+
+    void testSpatialHash()
+    {
+        std::cout << "Running tests for SpatialHash..." << std::endl;
+
+        std::mt19937 rng(52); // Fixed seed for reproducibility
+        std::uniform_real_distribution<double> dist(-1000.0, 1000.0);
+        std::normal_distribution<double> step(0.0, 10.0);
+
+        auto grid = SpatialHash<double>(40.0);
+        for (int iter = 0; iter < 12; ++iter)
+        {
+            const size_type numPoints = rng() % 1000;
+            auto points = NDArray<double, 2>::Empty({numPoints, 2});
+            for (size_type i = 0; i < numPoints; ++i)
+            {
+                points(i, 0) = dist(rng);
+                points(i, 1) = dist(rng);
+            }
+
+            // Move the points a few frames, rebuilding the same grid each time
+            for (int frame = 0; frame < 3; ++frame)
+            {
+                grid.build(points);
+                assert(grid.size() == numPoints);
+
+                testSpatialHashInvariants(grid, points, grid.cellSize());
+                testSpatialHashInvariants(grid, points, 2.5 * grid.cellSize());
+
+                for (size_type i = 0; i < numPoints; ++i)
+                {
+                    points(i, 0) += step(rng);
+                    points(i, 1) += step(rng);
+                }
+            }
+        }
+
+        // Enough points for several chunks and bucket ranges on a machine
+        // with several threads
+        const size_type numPoints = 200000;
+        const double radius = 10.0;
+        auto points = NDArray<double, 2>::Empty({numPoints, 2});
+        for (size_type i = 0; i < numPoints; ++i)
+        {
+            points(i, 0) = dist(rng);
+            points(i, 1) = dist(rng);
+        }
+        grid.build(points);
+        assert(grid.size() == numPoints);
+
+        std::vector<size_type> found;
+        for (size_type q = 0; q < 20; ++q)
+        {
+            grid.radiusSearch(points(q, 0), points(q, 1), radius, found);
+            std::sort(found.begin(), found.end());
+
+            std::vector<size_type> expected;
+            for (size_type i = 0; i < numPoints; ++i)
+            {
+                const double dx = points(i, 0) - points(q, 0);
+                const double dy = points(i, 1) - points(q, 1);
+                if (dx * dx + dy * dy <= radius * radius)
+                    expected.push_back(i);
+            }
+            assert(found == expected && "Radius search mismatch on a large grid");
+        }
+    }
+
+}
@@ -0,0 +1,122 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Sparsh Jain
+ *
+ */
+
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+
+#include <cpp_eigen_opencv/shared/ndarray.hpp>
+#include <cpp_eigen_opencv/shared/geometry.hpp>
+#include <cpp_eigen_opencv/shared/streaming_hull.hpp>
+#include <cpp_eigen_opencv/shared/debug.hpp>
+
+namespace Geometry
+{
+    namespace
+    {
+        template <Arithmetic T>
+        bool sameHull(const NDArray<T, 2> &a, const NDArray<T, 2> &b)
+        {
+            if (a.shape() != b.shape())
+                return false;
+
+            for (size_type i = 0; i < a.shape()[0]; ++i)
+            {
+                if (a(i, 0) != b(i, 0) || a(i, 1) != b(i, 1))
+                    return false;
+            }
+            return true;
+        }
+
+        template <Arithmetic T, typename Distribution>
+        void testStreamingType(std::mt19937 &rng, Distribution dist)
+        {
+            for (int iter = 0; iter < 100; ++iter)
+            {
+                const size_type numPoints = rng() % 3000;
+                const size_type chunkRows = rng() % 300 + 1;
+                auto points = NDArray<T, 2>::Empty({numPoints, 2});
+                for (size_type i = 0; i < numPoints; ++i)
+                {
+                    points(i, 0) = static_cast<T>(dist(rng));
+                    points(i, 1) = static_cast<T>(dist(rng));
+                }
+
+                DEBUG_ONLY const auto expected = computeConvexHull(points);
+
+                // Generator that hands out the points in chunks
+                size_type next = 0;
+                DEBUG_ONLY const auto hull = streamingConvexHull<T>(
+                    [&](NDArray<T, 2> &buffer)
+                    {
+                        const auto rows = std::min(buffer.shape()[0], numPoints - next);
+                        for (size_type i = 0; i < rows; ++i)
+                        {
+                            buffer(i, 0) = points(next + i, 0);
+                            buffer(i, 1) = points(next + i, 1);
+                        }
+                        next += rows;
+                        return rows;
+                    },
+                    chunkRows);
+                assert(next == numPoints && "Generator not drained");
+                assert(sameHull(hull, expected) && "Streaming hull mismatch");
+
+                // Raw binary stream, as read from a file
+                std::string bytes(reinterpret_cast<const char *>(points.data()), points.size() * sizeof(T));
+                std::istringstream stream(bytes);
+                assert(sameHull(streamingConvexHull<T>(BinaryPointReader<T>(stream), chunkRows), expected) &&
+                       "Binary stream hull mismatch");
+
+                // Windows over an array, and the rectangle of the same hull
+                DEBUG_ONLY const auto rectangle = streamingMinAreaRectangle<T>(ArrayPointReader<T>(points), chunkRows);
+                DEBUG_ONLY const auto expectedRectangle = minAreaRectangle(points);
+                assert(rectangle.size[0] == expectedRectangle.size[0] &&
+                       rectangle.size[1] == expectedRectangle.size[1] &&
+                       rectangle.angle == expectedRectangle.angle &&
+                       "Streaming rectangle mismatch");
+            }
+        }
+    }
+
+    void testStreamingConvexHull()
+    {
+        std::cout << "Running tests for streamingConvexHull..." << std::endl;
+
+        std::mt19937 rng(60); // Fixed seed for reproducibility
+        testStreamingType<double>(rng, std::uniform_real_distribution<double>(-1000.0, 1000.0));
+        testStreamingType<std::int16_t>(rng, std::uniform_int_distribution<int>(-50, 50));
+
+        // Points inside or on the running hull leave it unchanged
+        StreamingConvexHull<double> hull;
+        auto square = NDArray<double, 2>::Empty({4, 2});
+        square(0, 0) = 0.0;
+        square(0, 1) = 0.0;
+        square(1, 0) = 2.0;
+        square(1, 1) = 0.0;
+        square(2, 0) = 2.0;
+        square(2, 1) = 2.0;
+        square(3, 0) = 0.0;
+        square(3, 1) = 2.0;
+        hull.add(square);
+
+        auto inner = NDArray<double, 2>::Empty({3, 2});
+        inner(0, 0) = 1.0;
+        inner(0, 1) = 1.0;
+        inner(1, 0) = 1.0;
+        inner(1, 1) = 0.0;
+        inner(2, 0) = 2.0;
+        inner(2, 1) = 2.0;
+        hull.add(inner);
+        assert(sameHull(hull.hull(), square) && "Interior points changed the hull");
+
+        DEBUG_ONLY const auto rectangle = hull.minAreaRectangle();
+        assert(rectangle.size[0] * rectangle.size[1] == 4.0 && "Running rectangle mismatch");
+    }
+
+} // namespace Geometry
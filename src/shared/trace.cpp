@@ -0,0 +1,214 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Sparsh Jain
+ *
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+
+#include <cpp_eigen_opencv/shared/trace.hpp>
+#include <cpp_eigen_opencv/shared/parallel.hpp>
+#include <cpp_eigen_opencv/shared/debug.hpp>
+
+namespace Trace
+{
+    namespace
+    {
+        static_assert((bufferCapacity & (bufferCapacity - 1)) == 0, "bufferCapacity must be a power of two");
+
+        // Single producer ring, only the owning thread writes events and
+        // head, readers take whatever head says has been published
+        struct Buffer
+        {
+            std::uint32_t id{0};
+            std::vector<Event> events = std::vector<Event>(bufferCapacity);
+            std::atomic<std::uint64_t> head{0};
+            std::atomic<bool> inUse{false};
+        };
+
+        std::mutex &registryMutex()
+        {
+            static std::mutex mutex;
+            return mutex;
+        }
+
+        // Buffers are never freed, a thread that exits hands its buffer
+        // back and the next new thread picks it up
+        std::vector<std::unique_ptr<Buffer>> &registry()
+        {
+            static std::vector<std::unique_ptr<Buffer>> buffers;
+            return buffers;
+        }
+
+        Buffer *acquireBuffer()
+        {
+            const std::lock_guard lock(registryMutex());
+            auto &buffers = registry();
+            for (auto &buffer : buffers)
+            {
+                if (!buffer->inUse.load(std::memory_order_relaxed))
+                {
+                    buffer->inUse.store(true, std::memory_order_relaxed);
+                    return buffer.get();
+                }
+            }
+
+            buffers.push_back(std::make_unique<Buffer>());
+            buffers.back()->id = static_cast<std::uint32_t>(buffers.size() - 1);
+            buffers.back()->inUse.store(true, std::memory_order_relaxed);
+            return buffers.back().get();
+        }
+
+        struct ThreadBuffer
+        {
+            Buffer *buffer{acquireBuffer()};
+
+            ThreadBuffer() = default;
+            ThreadBuffer(const ThreadBuffer &) = delete;
+            ThreadBuffer &operator=(const ThreadBuffer &) = delete;
+
+            ~ThreadBuffer()
+            {
+                const std::lock_guard lock(registryMutex());
+                buffer->inUse.store(false, std::memory_order_relaxed);
+            }
+        };
+
+        Buffer &localBuffer()
+        {
+            thread_local ThreadBuffer local;
+            return *local.buffer;
+        }
+    }
+
+    std::int64_t now()
+    {
+        static const auto epoch = std::chrono::steady_clock::now();
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch).count();
+    }
+
+    void record(const char *name, std::int64_t startNs, std::int64_t endNs)
+    {
+        auto &buffer = localBuffer();
+        const auto head = buffer.head.load(std::memory_order_relaxed);
+        buffer.events[head & (bufferCapacity - 1)] = Event{name, startNs, endNs - startNs, buffer.id};
+        buffer.head.store(head + 1, std::memory_order_release);
+    }
+
+    std::vector<Event> events()
+    {
+        std::vector<Event> result;
+        {
+            const std::lock_guard lock(registryMutex());
+            for (const auto &buffer : registry())
+            {
+                const auto head = buffer->head.load(std::memory_order_acquire);
+                const auto count = std::min<std::uint64_t>(head, bufferCapacity);
+                for (auto i = head - count; i < head; ++i)
+                    result.push_back(buffer->events[i & (bufferCapacity - 1)]);
+            }
+        }
+
+        std::stable_sort(result.begin(), result.end(), [](const Event &a, const Event &b)
+                         { return a.startNs < b.startNs; });
+        return result;
+    }
+
+    void clear()
+    {
+        const std::lock_guard lock(registryMutex());
+        for (auto &buffer : registry())
+            buffer->head.store(0, std::memory_order_release);
+    }
+
+    void writeChromeTrace(std::ostream &out, const std::vector<Event> &all)
+    {
+        const auto flags = out.flags();
+        out.setf(std::ios::fixed);
+        const auto precision = out.precision(3);
+
+        out << "{\"traceEvents\": [";
+        for (std::size_t i = 0; i < all.size(); ++i)
+        {
+            const auto &event = all[i];
+            out << (i == 0 ? "\n" : ",\n")
+                << "  {\"name\": \"" << event.name << "\", \"cat\": \"nd\", \"ph\": \"X\""
+                << ", \"ts\": " << static_cast<double>(event.startNs) / 1e3
+                << ", \"dur\": " << static_cast<double>(event.durationNs) / 1e3
+                << ", \"pid\": 1, \"tid\": " << event.thread << "}";
+        }
+        out << "\n], \"displayTimeUnit\": \"ns\"}\n";
+
+        out.precision(precision);
+        out.flags(flags);
+    }
+
+    /**************************************************************************/
+
+    void testTrace()
+    {
+        std::cout << "Running tests for tracing..." << std::endl;
+
+        clear();
+        {
+            TRACE_SCOPE("test.outer");
+            {
+                TRACE_SCOPE("test.inner");
+            }
+            Parallel::parallelFor(0, 8, [](std::size_t)
+                                  { TRACE_SCOPE("test.worker"); }, 1);
+        }
+
+        DEBUG_ONLY const auto recorded = events();
+        if constexpr (enabled)
+        {
+            assert(recorded.size() == 10 && "Unexpected event count");
+
+            const auto find = [&recorded](const std::string &name)
+            { return *std::find_if(recorded.begin(), recorded.end(), [&name](const Event &e)
+                                   { return name == e.name; }); };
+            DEBUG_ONLY const auto outer = find("test.outer");
+            DEBUG_ONLY const auto inner = find("test.inner");
+            assert(inner.startNs >= outer.startNs &&
+                   inner.startNs + inner.durationNs <= outer.startNs + outer.durationNs &&
+                   "Inner scope not nested in outer scope");
+            assert(inner.thread == outer.thread && "Scopes on one thread got two buffers");
+
+            DEBUG_ONLY const auto workers = std::count_if(recorded.begin(), recorded.end(), [](const Event &e)
+                                                          { return std::string(e.name) == "test.worker"; });
+            assert(workers == 8 && "Worker events missed");
+        }
+        else
+        {
+            assert(recorded.empty() && "TRACE_SCOPE recorded without ND_TRACE");
+        }
+
+        // The ring keeps the newest events once it wraps
+        clear();
+        for (std::size_t i = 0; i < bufferCapacity + 5; ++i)
+            record("test.wrap", static_cast<std::int64_t>(i), static_cast<std::int64_t>(i) + 1);
+        DEBUG_ONLY const auto wrapped = events();
+        assert(wrapped.size() == bufferCapacity && "Ring buffer did not cap");
+        assert(wrapped.front().startNs == 5 && wrapped.back().startNs == static_cast<std::int64_t>(bufferCapacity) + 4 &&
+               "Ring buffer dropped the wrong events");
+
+        clear();
+        record("test.json", 1500, 4000);
+        std::ostringstream json;
+        writeChromeTrace(json);
+        assert(json.str().find("\"name\": \"test.json\", \"cat\": \"nd\", \"ph\": \"X\", \"ts\": 1.500, \"dur\": 2.500") !=
+                   std::string::npos &&
+               "Unexpected Chrome trace output");
+        clear();
+    }
+
+} // namespace Trace